@@ -0,0 +1,74 @@
+#ifndef __ARG_SORT_H__
+#define __ARG_SORT_H__
+
+#include "utility.h"				// ʵó
+#include "sort_compare.h"			// ȽϺ
+#include "quick_sort.h"				// ʡ
+#include "tim_sort.h"				// Ӧ鲢
+
+// : ƶԪ,ֻԪص,õindex.¼ϴʱ
+//	,ApplyPermutationһν¼Ƶλ,ÿ¼ֻƶһ,ֱ
+//	¼
+
+// űȽϺģ: űȽеԪ
+template <class ElemType, class Compare>
+class IndexCompare
+{
+protected:
+//  űȽϵݳԱ:
+	const ElemType *elem;						// 
+	Compare comp;								// ԪصıȽϺ
+
+public:
+//  :
+	IndexCompare(const ElemType e[], Compare c): elem(e), comp(c) {}	// 캯ģ
+	bool operator()(int i, int j) const			// Ƚelem[i]elem[j]
+	{
+		return comp(elem[i], elem[j]);
+	}
+};
+
+template <class ElemType, class Compare = LessCompare>
+void ArgSort(const ElemType elem[], int n, int index[], Compare comp = Compare())
+// : index[0 .. n - 1],ʹelem[index[0]], elem[index[1]], ...Ƚ
+//	comp, elem.ʡ,ؼȵԪصŴȷ
+{
+	for (int i = 0; i < n; i++) index[i] = i;
+	IntroSort(index, n, IndexCompare<ElemType, Compare>(elem, comp));
+}
+
+template <class ElemType, class Compare = LessCompare>
+void StableArgSort(const ElemType elem[], int n, int index[], Compare comp = Compare())
+// : ͬArgSort,ؼȵԪذŵ.Ӧ鲢,ʱӽ
+//	O(n)
+{
+	for (int i = 0; i < n; i++) index[i] = i;
+	TimSort(index, n, IndexCompare<ElemType, Compare>(elem, comp));
+}
+
+template <class ElemType>
+void ApplyPermutation(ElemType elem[], int n, const int index[])
+// ʼ: index[0 .. n - 1]0 .. n - 1һ
+// : elemΪelem[index[0]], elem[index[1]], ..., elem[index[n - 1]].е
+//	ƶԪ,ÿֻݴһԪ,ƶn + 
+{
+	bool *done = new bool[n > 0 ? n : 1];		// λǷѷź
+	for (int i = 0; i < n; i++) done[i] = false;
+	for (int i = 0; i < n; i++)
+	{	// iڵĻ
+		if (done[i]) continue;
+		ElemType e = elem[i];					// ݴ滷Ԫ
+		int j = i;
+		while (index[j] != i)
+		{	// elem[j]ȡelem[index[j]],ػǰ
+			elem[j] = elem[index[j]];
+			done[j] = true;
+			j = index[j];
+		}
+		elem[j] = e;
+		done[j] = true;
+	}
+	delete []done;								// ͷdoneռÿռ
+}
+
+#endif
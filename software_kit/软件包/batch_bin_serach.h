@@ -0,0 +1,48 @@
+#ifndef __BATCH_BIN_SERACH_H__
+#define __BATCH_BIN_SERACH_H__
+
+#include "simd_support.h"				// SIMDָ֧
+
+#define BATCH_SEARCH_GROUP 16			// ͬʱƽĲҸ
+
+template <class ElemType, class KeyType>
+void BatchBinSerach(ElemType elem[], int n, const KeyType keys[], int keyCount, int result[])
+// : elemвkeys[0 .. keyCount - 1],һСkeys[i]λ,
+//	λõļ¼keys[i]ʱresult[i],Ϊ-1.ظԪʱǷصһ,
+//	BinSerachܷһ.ÿBATCH_SEARCH_GROUPؼΪһͬƽ,ÿһ
+//	ԤȡڸһҪʵѡλ,޷֧С,ʹҵķôӳ
+//	໥ص
+{
+	int base[BATCH_SEARCH_GROUP];		// ҵĵǰ
+	for (int first = 0; first < keyCount; first += BATCH_SEARCH_GROUP)
+	{	// һؼ
+		int g = keyCount - first < BATCH_SEARCH_GROUP ? keyCount - first : BATCH_SEARCH_GROUP;
+		const KeyType *k = keys + first;
+		int i;							// ʱ
+
+		for (i = 0; i < g; i++) base[i] = 0;
+		int len = n;					// ҵ䳤ͬ,Ϊelem[base .. base + len - 1]
+		while (len > 1)
+		{	// ͬС
+			int half = len / 2;
+			for (i = 0; i < g; i++)
+			{	// Ԥȡһܷʵλ
+				PREFETCH(elem + base[i] + half / 2);
+				PREFETCH(elem + base[i] + half + half / 2);
+			}
+			for (i = 0; i < g; i++)
+			{	// ޷֧ѡҰ
+				base[i] = (elem[base[i] + half - 1] < k[i]) ? base[i] + half : base[i];
+			}
+			len -= half;
+		}
+		for (i = 0; i < g; i++)
+		{	// ֻʣһԪ,жǷҳɹ
+			int pos = base[i];
+			if (n > 0 && elem[pos] < k[i]) pos++;	// һСڹؼֵλ
+			result[first + i] = (pos < n && elem[pos] == k[i]) ? pos : -1;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef __BLOOM_FILTER_H__
+#define __BLOOM_FILTER_H__
+
+#include "utility.h"								// ʵó
+#include "simd_support.h"							// SIMDָ֧
+
+#define BLOOM_BLOCK_WORDS 16						// ÿ32λ,һΪ64ֽ
+#define BLOOM_HASH_COUNT 8							// ÿؼλλ
+
+// ¡Ŀ,СΪһ,AllocateBlocksб߽
+struct BloomBlock
+{
+	unsigned int word[BLOOM_BLOCK_WORDS];			// λ
+};
+
+// ֿ鲼¡ģ: ÿؼֵȫBLOOM_HASH_COUNTλͬһ64ֽڵĿ,
+//	ѯֻһ
+template <class KeyType>
+class BlockedBloomFilter
+{
+protected:
+//  ¡ݳԱ:
+	char *storage;									// Ĵ洢ռ
+	BloomBlock *blocks;								// ,ʼڻб߽
+	int blockCount;									// 
+	int count;										// ѲĹؼָ
+
+//	ģ:
+	void AllocateBlocks();							// blockCountĴ洢ռ
+	int BlockOf(unsigned long long h) const;		// ɢֵhڵĿ
+	static void MakeMask(unsigned long long h, unsigned int mask[]);	// ɢֵhڿڵλ
+	static bool TestBlock(const BloomBlock &block, const unsigned int mask[]);
+		// жϿǷmaskȫλ
+
+public:
+//  ¡رϵͳĬϷ:
+	BlockedBloomFilter(int expectedCount, double bitsPerKey = 10);
+		// expectedCountؼ,ÿؼԼbitsPerKeyλĿչ
+	virtual ~BlockedBloomFilter();					// 캯ģ
+	void Clear();									// չ
+	void Insert(const KeyType &key);				// ؼkey
+	bool MayContain(const KeyType &key) const;		// жϹؼkeyǷܴ
+	int Length() const;								// ѲĹؼָ
+	double BitsPerKey() const;						// ÿؼռλ
+	double EstimatedFalsePositiveRate() const;		// λ
+	BlockedBloomFilter(const BlockedBloomFilter<KeyType> &copy);	// ƹ캯ģ
+	BlockedBloomFilter<KeyType> &operator=(const BlockedBloomFilter<KeyType> &copy);
+		// ظֵ
+};
+
+// ֿ鲼¡ģʵֲ
+template <class KeyType>
+void BlockedBloomFilter<KeyType>::AllocateBlocks()
+// : blockCountĴ洢ռ,һ,ʹblocksʼڻб߽,
+//	C++17ǰnew֤ж
+{
+	storage = new char[(size_t)blockCount * sizeof(BloomBlock) + CACHE_LINE_SIZE];
+	blocks = (BloomBlock *)(storage + (CACHE_LINE_SIZE - (size_t)storage % CACHE_LINE_SIZE) % CACHE_LINE_SIZE);
+}
+
+template <class KeyType>
+int BlockedBloomFilter<KeyType>::BlockOf(unsigned long long h) const
+// : ɢֵhڵĿ,ø32λԿȡλ,ȡ
+{
+	return (int)(((h >> 32) * (unsigned long long)blockCount) >> 32);
+}
+
+template <class KeyType>
+void BlockedBloomFilter<KeyType>::MakeMask(unsigned long long h, unsigned int mask[])
+// : ɢֵhĵ32λɿڵλ: iɢòͬ,2i
+//	2i + 1һλ,ʹBLOOM_HASH_COUNTλڲͬ
+{
+	static const unsigned int salt[BLOOM_HASH_COUNT] = {
+		0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+		0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+	unsigned int x = (unsigned int)h;				// 32λ
+	for (int i = 0; i < BLOOM_BLOCK_WORDS; i++) mask[i] = 0;
+	for (int i = 0; i < BLOOM_HASH_COUNT; i++)
+	{	// iɢ
+		unsigned int y = x * salt[i];
+		mask[2 * i + ((y >> 26) & 1)] |= 1U << (y >> 27);
+	}
+}
+
+template <class KeyType>
+bool BlockedBloomFilter<KeyType>::TestBlock(const BloomBlock &block, const unsigned int mask[])
+// : кmaskȫλtrue,򷵻false
+{
+#ifdef SIMD_SSE2
+	__m128i miss = _mm_setzero_si128();				// ȱٵλ
+	for (int i = 0; i < BLOOM_BLOCK_WORDS; i += 4)
+	{	// ÿμ4
+		__m128i m = _mm_loadu_si128((const __m128i *)(mask + i));
+		__m128i b = _mm_load_si128((const __m128i *)(block.word + i));
+		miss = _mm_or_si128(miss, _mm_andnot_si128(b, m));
+	}
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(miss, _mm_setzero_si128())) == 0xFFFF;
+#else
+	unsigned int miss = 0;
+	for (int i = 0; i < BLOOM_BLOCK_WORDS; i++)
+	{	// ּ
+		miss |= mask[i] & ~block.word[i];
+	}
+	return miss == 0;
+#endif
+}
+
+template <class KeyType>
+BlockedBloomFilter<KeyType>::BlockedBloomFilter(int expectedCount, double bitsPerKey)
+// : expectedCountؼ,ÿؼԼbitsPerKeyλĿչ
+{
+	blockCount = (int)(expectedCount * bitsPerKey / (BLOOM_BLOCK_WORDS * 32)) + 1;
+	AllocateBlocks();								// 洢ռ
+	Clear();
+}
+
+template <class KeyType>
+BlockedBloomFilter<KeyType>::~BlockedBloomFilter()
+// : ٹ
+{
+	delete []storage;
+}
+
+template <class KeyType>
+void BlockedBloomFilter<KeyType>::Clear()
+// : չ
+{
+	memset(blocks, 0, sizeof(BloomBlock) * blockCount);
+	count = 0;
+}
+
+template <class KeyType>
+void BlockedBloomFilter<KeyType>::Insert(const KeyType &key)
+// : ؼkey
+{
+	unsigned long long h = HashMix((unsigned long long)key);	// ɢֵ
+	unsigned int mask[BLOOM_BLOCK_WORDS];			// ڵλ
+	MakeMask(h, mask);
+	BloomBlock &block = blocks[BlockOf(h)];
+	for (int i = 0; i < BLOOM_BLOCK_WORDS; i++)
+	{	// λ
+		block.word[i] |= mask[i];
+	}
+	count++;
+}
+
+template <class KeyType>
+bool BlockedBloomFilter<KeyType>::MayContain(const KeyType &key) const
+// : ؼkeyܴʱtrue,ȷʱfalse
+{
+	unsigned long long h = HashMix((unsigned long long)key);	// ɢֵ
+	unsigned int mask[BLOOM_BLOCK_WORDS];			// ڵλ
+	MakeMask(h, mask);
+	return TestBlock(blocks[BlockOf(h)], mask);
+}
+
+template <class KeyType>
+int BlockedBloomFilter<KeyType>::Length() const
+// : ѲĹؼָ
+{
+	return count;
+}
+
+template <class KeyType>
+double BlockedBloomFilter<KeyType>::BitsPerKey() const
+// : ÿѲĹؼռλ
+{
+	return count == 0 ? 0 : (double)blockCount * BLOOM_BLOCK_WORDS * 32 / count;
+}
+
+template <class KeyType>
+double BlockedBloomFilter<KeyType>::EstimatedFalsePositiveRate() const
+// : λ: ڵĹؼĳʱ,BLOOM_HASH_COUNTλ
+//	λĸԼΪÿλBLOOM_HASH_COUNTη,Ըȡƽ
+{
+	double sum = 0;
+	for (int b = 0; b < blockCount; b++)
+	{	// ۼӸи
+		int ones = 0;								// λλ
+		for (int i = 0; i < BLOOM_BLOCK_WORDS; i++)
+		{	// ͳλ
+			for (unsigned int w = blocks[b].word[i]; w != 0; w &= w - 1) ones++;
+		}
+		sum += pow((double)ones / (BLOOM_BLOCK_WORDS * 32), BLOOM_HASH_COUNT);
+	}
+	return sum / blockCount;
+}
+
+template <class KeyType>
+BlockedBloomFilter<KeyType>::BlockedBloomFilter(const BlockedBloomFilter<KeyType> &copy)
+// ɹcopy¹ƹ캯ģ
+{
+	blockCount = copy.blockCount;
+	count = copy.count;
+	AllocateBlocks();
+	memcpy(blocks, copy.blocks, sizeof(BloomBlock) * blockCount);
+}
+
+template <class KeyType>
+BlockedBloomFilter<KeyType> &BlockedBloomFilter<KeyType>::operator=(const BlockedBloomFilter<KeyType> &copy)
+// copyֵǰظֵ
+{
+	if (&copy != this)
+	{
+		delete []storage;
+		blockCount = copy.blockCount;
+		count = copy.count;
+		AllocateBlocks();
+		memcpy(blocks, copy.blocks, sizeof(BloomBlock) * blockCount);
+	}
+	return *this;
+}
+
+#endif
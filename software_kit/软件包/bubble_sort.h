@@ -1,15 +1,18 @@
 #ifndef __BUBBLE_SORT_H__
 #define __BUBBLE_SORT_H__
 
-template <class ElemType>
-void BubbleSort(ElemType elem[], int n)
-// :elem
+#include "utility.h"				// ʵó
+#include "sort_compare.h"			// ȽϺ
+
+template <class ElemType, class Compare = LessCompare>
+void BubbleSort(ElemType elem[], int n, Compare comp = Compare())
+// :elemаȽϺcomp
 {
 	for (int i = n - 1; i > 0; i--)
 	{	// i
 		for (int j = 0; j < i; j++)
 		{	// Ƚelem[j]elem[j + 1]
-			if (elem[j] > elem[j + 1])
+			if (comp(elem[j + 1], elem[j]))
 			{	// ,򽻻elem[j]elem[j + 1]
 				Swap(elem[j], elem[j + 1]);
 			}
@@ -0,0 +1,217 @@
+#ifndef __CONCURRENT_HASH_TABLE_H__
+#define __CONCURRENT_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+#include "simd_support.h"							// CACHE_LINE_SIZE
+#include "flat_hash_table.h"						// ̽ɢб
+#include <mutex>									// 
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <shared_mutex>								// д
+#define CONCURRENT_STD_SHARED_MUTEX					// ʹñ׼Ķд
+#else
+#include <condition_variable>						// 
+#endif
+
+#ifdef CONCURRENT_STD_SHARED_MUTEX
+typedef shared_mutex ReadWriteLock;					// д
+#else
+// д: C++17֮ǰûshared_mutex,ûʵ,д,д߼
+class ReadWriteLock
+{
+protected:
+//  дݳԱ:
+	mutex guard;									// ״̬
+	condition_variable changed;						// ״̬ı
+	int readers;									// ж߳
+	int waitingWriters;								// ȴд߳
+	bool writing;									// Ƿ̳߳д
+
+public:
+//  д,׼ͬ,lock_guard:
+	ReadWriteLock(): readers(0), waitingWriters(0), writing(false) {}
+	void lock()										// д
+	{
+		unique_lock<mutex> g(guard);
+		waitingWriters++;
+		while (writing || readers > 0) changed.wait(g);
+		waitingWriters--;
+		writing = true;
+	}
+	void unlock()									// д
+	{
+		lock_guard<mutex> g(guard);
+		writing = false;
+		changed.notify_all();
+	}
+	void lock_shared()								// Ӷ
+	{
+		unique_lock<mutex> g(guard);
+		while (writing || waitingWriters > 0) changed.wait(g);
+		readers++;
+	}
+	void unlock_shared()							// 
+	{
+		lock_guard<mutex> g(guard);
+		if (--readers == 0) changed.notify_all();
+	}
+};
+#endif
+
+// : ʱӶ,ʱ
+class ReadLockGuard
+{
+protected:
+	ReadWriteLock &lock;							// д
+
+public:
+	ReadLockGuard(ReadWriteLock &l): lock(l) { lock.lock_shared(); }
+	~ReadLockGuard() { lock.unlock_shared(); }
+};
+
+// Ƭɢбģ: ؼְɢֵ䵽Ƭ,ÿƬһдķ̽
+//	ɢб,ɾɾ,ж̽,ԪʱƬ.ͬƬϵĲ
+//	,ͬһƬϵĲҿɲ
+template <class ElemType, class KeyType>
+class ConcurrentHashTable
+{
+protected:
+// Ƭṹ,ĩβһ,ⲻͬƬα.alignas,C++17֮ǰnew
+//	֤Ĭ϶ĶҪ
+	struct Shard
+	{
+		FlatHashTable<ElemType, KeyType> *table;	// Ƭɢб
+		mutable ReadWriteLock lock;					// Ƭд
+		char pad[CACHE_LINE_SIZE];					// 
+	};
+
+//  ɢбݳԱ:
+	Shard *shards;									// Ƭ
+	int shardCount;									// Ƭ
+
+//	ģ:
+	Shard &ShardOf(const KeyType &key) const;		// ؼkeyڵķƬ
+
+public:
+//  ɢб:
+	ConcurrentHashTable(int size, int nShards = 32);// 캯ģ
+	~ConcurrentHashTable();							// 캯ģ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Insert(const ElemType &e);					// Ԫe
+	bool Delete(const KeyType &key);				// ɾؼΪkeyԪ
+	bool Upsert(const ElemType &e);					// Ԫe,Ѵ滻
+	template <class Factory>
+	bool ComputeIfAbsent(const KeyType &key, Factory make, ElemType &e);
+		// ؼΪkeyԪز,make(key),eԪصֵ
+
+private:
+	ConcurrentHashTable(const ConcurrentHashTable<ElemType, KeyType> &copy);	// ֹ
+	ConcurrentHashTable<ElemType, KeyType> &operator=
+		(const ConcurrentHashTable<ElemType, KeyType> &copy);	// ֵֹ
+};
+
+// ɢбģʵֲ
+template <class ElemType, class KeyType>
+typename ConcurrentHashTable<ElemType, KeyType>::Shard &
+ConcurrentHashTable<ElemType, KeyType>::ShardOf(const KeyType &key) const
+// : عؼkeyڵķƬ,ȡɢֵĸλ,Ƭڵĳ໥
+{
+	return shards[(HashMix((unsigned long long)key) >> 32) % shardCount];
+}
+
+template <class ElemType, class KeyType>
+ConcurrentHashTable<ElemType, KeyType>::ConcurrentHashTable(int size, int nShards)
+// : ԼΪsize, ΪnShardsƬĿɢб
+{
+	shardCount = nShards;							// Ƭ
+	shards = new Shard[shardCount];					// Ƭ
+	int capacity = size / shardCount + 1;			// ÿƬĳʼ
+	for (int i = 0; i < shardCount; i++)
+	{	// Ƭɢб,װӳ7/8ʱ
+		shards[i].table = new FlatHashTable<ElemType, KeyType>(capacity);
+	}
+}
+
+template <class ElemType, class KeyType>
+ConcurrentHashTable<ElemType, KeyType>::~ConcurrentHashTable()
+// : ɢб
+{
+	for (int i = 0; i < shardCount; i++)
+	{	// ͷŸƬɢб
+		delete shards[i].table;
+	}
+	delete []shards;
+}
+
+template <class ElemType, class KeyType>
+void ConcurrentHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζÿƬӶԪ
+{
+	for (int i = 0; i < shardCount; i++)
+	{	// iƬ
+		ReadLockGuard guard(shards[i].lock);
+		shards[i].table->Traverse(visit);
+	}
+}
+
+template <class ElemType, class KeyType>
+bool ConcurrentHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false.ֻڷƬӶ
+{
+	Shard &shard = ShardOf(key);
+	ReadLockGuard guard(shard.lock);
+	return shard.table->Search(key, e);
+}
+
+template <class ElemType, class KeyType>
+bool ConcurrentHashTable<ElemType, KeyType>::Insert(const ElemType &e)
+// : ɢбвԪe,ɹtrue,򷵻false
+{
+	Shard &shard = ShardOf(e);
+	lock_guard<ReadWriteLock> guard(shard.lock);
+	return shard.table->Insert(e);
+}
+
+template <class ElemType, class KeyType>
+bool ConcurrentHashTable<ElemType, KeyType>::Delete(const KeyType &key)
+// : ɾؼΪkeyԪ,ɾɹtrue,򷵻false
+{
+	Shard &shard = ShardOf(key);
+	lock_guard<ReadWriteLock> guard(shard.lock);
+	return shard.table->Delete(key);
+}
+
+template <class ElemType, class KeyType>
+bool ConcurrentHashTable<ElemType, KeyType>::Upsert(const ElemType &e)
+// : ؼeͬԪѴ,e滻֮,e,true
+{
+	Shard &shard = ShardOf(e);
+	lock_guard<ReadWriteLock> guard(shard.lock);
+	shard.table->Delete(e);							// ɾԭԪ
+	return shard.table->Insert(e);					// Ԫ
+}
+
+template <class ElemType, class KeyType>
+template <class Factory>
+bool ConcurrentHashTable<ElemType, KeyType>::ComputeIfAbsent(const KeyType &key,
+	Factory make, ElemType &e)
+// : ؼΪkeyԪش,eֵ;д²make(key),
+//	eԪصֵ,makeͬһؼֻһ,true
+{
+	Shard &shard = ShardOf(key);
+	{	// ڶ²
+		ReadLockGuard guard(shard.lock);
+		if (shard.table->Search(key, e)) return true;
+	}
+
+	lock_guard<ReadWriteLock> guard(shard.lock);
+	if (shard.table->Search(key, e))
+	{	// ͷŶѱ̲߳
+		return true;
+	}
+	e = make(key);									// Ԫ
+	return shard.table->Insert(e);
+}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef __COUNTING_BLOOM_FILTER_H__
+#define __COUNTING_BLOOM_FILTER_H__
+
+#include "bloom_filter.h"							// ֿ鲼¡
+
+#define BLOOM_COUNTER_MAX 15						// 4λֵ,ﵽ
+
+// ¡ģ: ÿһλһ4λ¼λ,֧ɾ.ѯֻ
+//	λ,ֿ鲼¡ֻͬһ.˽м̳зֿ鲼¡,ͨ
+//	õInsertClearƹ,ʹԺɾʹ
+template <class KeyType>
+class CountingBloomFilter: private BlockedBloomFilter<KeyType>
+{
+protected:
+//  ¡ݳԱ:
+	unsigned char *counters;						// ,ÿֽڴ
+
+//	ģ:
+	int GetCounter(long long index) const;			// ȡindex
+	void SetCounter(long long index, int value);	// õindex
+	long long CounterBytes() const;					// ռֽ
+
+public:
+//  ¡رϵͳĬϷ:
+	CountingBloomFilter(int expectedCount, double bitsPerKey = 10);
+		// expectedCountؼ,λÿؼԼbitsPerKeyλĿչ
+	virtual ~CountingBloomFilter();					// 캯ģ
+	void Clear();									// չ
+	void Insert(const KeyType &key);				// ؼkey
+	bool Delete(const KeyType &key);				// ɾؼkey
+	bool MayContain(const KeyType &key) const;		// жϹؼkeyǷܴ
+	int Length() const;								// ѲĹؼָ
+	double BitsPerKey() const;						// ÿؼռλ,
+	double EstimatedFalsePositiveRate() const;		// λ
+	CountingBloomFilter(const CountingBloomFilter<KeyType> &copy);	// ƹ캯ģ
+	CountingBloomFilter<KeyType> &operator=(const CountingBloomFilter<KeyType> &copy);
+		// ظֵ
+};
+
+// ¡ģʵֲ
+template <class KeyType>
+int CountingBloomFilter<KeyType>::GetCounter(long long index) const
+// : صindexֵ
+{
+	unsigned char byte = counters[index / 2];
+	return index % 2 == 0 ? (byte & 0x0F) : (byte >> 4);
+}
+
+template <class KeyType>
+void CountingBloomFilter<KeyType>::SetCounter(long long index, int value)
+// : indexΪvalue
+{
+	unsigned char &byte = counters[index / 2];
+	if (index % 2 == 0) byte = (unsigned char)((byte & 0xF0) | value);
+	else byte = (unsigned char)((byte & 0x0F) | (value << 4));
+}
+
+template <class KeyType>
+long long CountingBloomFilter<KeyType>::CounterBytes() const
+// : ؼռֽ,ÿһλһ4λ
+{
+	return (long long)this->blockCount * BLOOM_BLOCK_WORDS * 32 / 2;
+}
+
+template <class KeyType>
+CountingBloomFilter<KeyType>::CountingBloomFilter(int expectedCount, double bitsPerKey):
+	BlockedBloomFilter<KeyType>(expectedCount, bitsPerKey)
+// : expectedCountؼ,λÿؼԼbitsPerKeyλĿչ,
+//	ռ4Ŀռ
+{
+	counters = new unsigned char[CounterBytes()];
+	Clear();
+}
+
+template <class KeyType>
+CountingBloomFilter<KeyType>::~CountingBloomFilter()
+// : ٹ
+{
+	delete []counters;
+}
+
+template <class KeyType>
+void CountingBloomFilter<KeyType>::Clear()
+// : չ
+{
+	BlockedBloomFilter<KeyType>::Clear();
+	memset(counters, 0, CounterBytes());
+}
+
+template <class KeyType>
+void CountingBloomFilter<KeyType>::Insert(const KeyType &key)
+// : ؼkey,Ӧ1
+{
+	unsigned long long h = HashMix((unsigned long long)key);	// ɢֵ
+	unsigned int mask[BLOOM_BLOCK_WORDS];			// ڵλ
+	this->MakeMask(h, mask);
+	int b = this->BlockOf(h);						// 
+	for (int i = 0; i < BLOOM_BLOCK_WORDS; i++)
+	{	// еÿһλ
+		for (unsigned int w = mask[i]; w != 0; w &= w - 1)
+		{
+			long long index = (long long)b * BLOOM_BLOCK_WORDS * 32 + i * 32 + LowestBitIndex(w);
+			int c = GetCounter(index);
+			if (c < BLOOM_COUNTER_MAX) SetCounter(index, c + 1);
+		}
+		this->blocks[b].word[i] |= mask[i];			// λ
+	}
+	this->count++;
+}
+
+template <class KeyType>
+bool CountingBloomFilter<KeyType>::Delete(const KeyType &key)
+// : ɾؼkey,Ӧ1,Ϊ0ʱλ,ɾɹtrue,ؼ
+//	ȷʱfalse.Ѵ޵ļټ,ɾؼ
+{
+	if (!this->MayContain(key)) return false;		// ؼֲ
+
+	unsigned long long h = HashMix((unsigned long long)key);	// ɢֵ
+	unsigned int mask[BLOOM_BLOCK_WORDS];			// ڵλ
+	this->MakeMask(h, mask);
+	int b = this->BlockOf(h);						// 
+	for (int i = 0; i < BLOOM_BLOCK_WORDS; i++)
+	{	// еÿһλ
+		for (unsigned int w = mask[i]; w != 0; w &= w - 1)
+		{
+			int bit = LowestBitIndex(w);
+			long long index = (long long)b * BLOOM_BLOCK_WORDS * 32 + i * 32 + bit;
+			int c = GetCounter(index);
+			if (c < BLOOM_COUNTER_MAX)
+			{	// δ
+				SetCounter(index, c - 1);
+				if (c == 1) this->blocks[b].word[i] &= ~(1U << bit);	// λ
+			}
+		}
+	}
+	this->count--;
+	return true;
+}
+
+template <class KeyType>
+bool CountingBloomFilter<KeyType>::MayContain(const KeyType &key) const
+// : ؼkeyܴʱtrue,ȷʱfalse
+{
+	return BlockedBloomFilter<KeyType>::MayContain(key);
+}
+
+template <class KeyType>
+int CountingBloomFilter<KeyType>::Length() const
+// : ѲĹؼָ
+{
+	return this->count;
+}
+
+template <class KeyType>
+double CountingBloomFilter<KeyType>::BitsPerKey() const
+// : ÿѲĹؼռλ,λ
+{
+	return this->count == 0 ? 0 :
+		((double)this->blockCount * BLOOM_BLOCK_WORDS * 32 + CounterBytes() * 8.0) / this->count;
+}
+
+template <class KeyType>
+double CountingBloomFilter<KeyType>::EstimatedFalsePositiveRate() const
+// : λλ
+{
+	return BlockedBloomFilter<KeyType>::EstimatedFalsePositiveRate();
+}
+
+template <class KeyType>
+CountingBloomFilter<KeyType>::CountingBloomFilter(const CountingBloomFilter<KeyType> &copy):
+	BlockedBloomFilter<KeyType>(copy)
+// ɹcopy¹ƹ캯ģ
+{
+	counters = new unsigned char[CounterBytes()];
+	memcpy(counters, copy.counters, CounterBytes());
+}
+
+template <class KeyType>
+CountingBloomFilter<KeyType> &CountingBloomFilter<KeyType>::operator=(const CountingBloomFilter<KeyType> &copy)
+// copyֵǰظֵ
+{
+	if (&copy != this)
+	{
+		BlockedBloomFilter<KeyType>::operator=(copy);
+		delete []counters;
+		counters = new unsigned char[CounterBytes()];
+		memcpy(counters, copy.counters, CounterBytes());
+	}
+	return *this;
+}
+
+#endif
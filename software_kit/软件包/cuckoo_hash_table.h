@@ -0,0 +1,411 @@
+#ifndef __CUCKOO_HASH_TABLE_H__
+#define __CUCKOO_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+#include "simd_support.h"							// SIMDָ֧
+#include <new>										// λnew
+
+#define CUCKOO_BUCKET_WIDTH 4						// ÿͰĲ
+#define CUCKOO_STASH_SIZE 8							// 
+#define CUCKOO_MAX_BFS 512							// ·ʱ
+
+// Ͱɢбģ: ÿԪֻλѡͰ֮һС,
+//	Ͱ,ҲO(1)
+template <class ElemType, class KeyType>
+class CuckooHashTable
+{
+protected:
+// Ͱе
+	struct BucketData
+	{
+		ElemType slot[CUCKOO_BUCKET_WIDTH];			// 
+		bool full[CUCKOO_BUCKET_WIDTH];				// Ƿռ
+	};
+
+// Ͱṹ,䵽е,ͰNewBucketsб߽.alignas,C++17
+//	֮ǰnew֤ж
+	struct Bucket: public BucketData
+	{
+		char pad[CACHE_LINE_SIZE - sizeof(BucketData) % CACHE_LINE_SIZE];	// 
+	};
+
+// ·Ľ
+	struct PathNode
+	{
+		int bucket;									// Ͱ
+		int parent;									// ˫׽,Ϊ-1
+		int slot;									// ˫Ͱ뱾ͰԪڲ
+	};
+
+//  ɢбݳԱ:
+	char *storage;									// ͰĴ洢ռ
+	Bucket *buckets;								// Ͱ,ʼڻб߽
+	int bucketCount;								// Ͱ,Ϊ2
+	ElemType stash[CUCKOO_STASH_SIZE];				// 
+	int stashCount;									// Ԫظ
+	int count;										// Ԫظ
+
+//	ģ:
+	static Bucket *NewBuckets(int n, char *&mem);	// nͰ,memطĴ洢ռ
+	static void DeleteBuckets(Bucket *b, int n, char *mem);	// ͷNewBucketsͰ
+	int H1(const KeyType &key) const;				// һɢк
+	int H2(const KeyType &key) const;				// ڶɢк
+	int AltBucket(const KeyType &key, int b) const;	// ԪͰb֮һѡͰ
+	bool SearchHelp(const KeyType &key, int &b, int &s) const;
+		// ѰؼΪkeyԪصλ,bΪ-1ʾ
+	bool FreeSlot(int b, int &s) const;				// ͰbĿղ
+	bool InsertHelp(const ElemType &e);				// ȷ֪ڵԪe
+	void Init(int nBuckets);						// ʼnBucketsͰĿɢб
+	void Rehash(int nBuckets);						// ɢбؽΪnBucketsͰ
+
+public:
+//  ɢбرϵͳĬϷ:
+	CuckooHashTable(int size = DEFAULT_SIZE);		// 캯ģ
+	~CuckooHashTable();								// 캯ģ
+	int Length() const;								// Ԫظ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Insert(const ElemType &e);					// Ԫe
+	bool Delete(const KeyType &key);				// ɾؼΪkeyԪ
+	CuckooHashTable(const CuckooHashTable<ElemType, KeyType> &copy);	// ƹ캯ģ
+	CuckooHashTable<ElemType, KeyType> &operator=
+		(const CuckooHashTable<ElemType, KeyType> &copy);	// ظֵ
+};
+
+// ɢбģʵֲ
+template <class ElemType, class KeyType>
+int CuckooHashTable<ElemType, KeyType>::H1(const KeyType &key) const
+// : صһѡͰ,ȡɢֵĵ32λ
+{
+	return (int)(HashMix((unsigned long long)key) & (bucketCount - 1));
+}
+
+template <class ElemType, class KeyType>
+int CuckooHashTable<ElemType, KeyType>::H2(const KeyType &key) const
+// : صڶѡͰ,ȡɢֵĸ32λ,һѡͰͬʱȡڵͰ
+{
+	unsigned long long h = HashMix((unsigned long long)key);
+	int b1 = (int)(h & (bucketCount - 1));
+	int b2 = (int)((h >> 32) & (bucketCount - 1));
+	return b2 != b1 ? b2 : b1 ^ 1;
+}
+
+template <class ElemType, class KeyType>
+int CuckooHashTable<ElemType, KeyType>::AltBucket(const KeyType &key, int b) const
+// : عؼΪkeyԪͰb֮һѡͰ
+{
+	int b1 = H1(key);
+	return b == b1 ? H2(key) : b1;
+}
+
+template <class ElemType, class KeyType>
+typename CuckooHashTable<ElemType, KeyType>::Bucket *CuckooHashTable<ElemType, KeyType>::
+NewBuckets(int n, char *&mem)
+// : nͰ,һ,ʼڻб߽Ͱ, memط
+//	洢ռ
+{
+	mem = new char[(size_t)n * sizeof(Bucket) + CACHE_LINE_SIZE];
+	Bucket *b = (Bucket *)(mem + (CACHE_LINE_SIZE - (size_t)mem % CACHE_LINE_SIZE) % CACHE_LINE_SIZE);
+	for (int i = 0; i < n; i++) new (b + i) Bucket;	// Ͱ
+	return b;
+}
+
+template <class ElemType, class KeyType>
+void CuckooHashTable<ElemType, KeyType>::DeleteBuckets(Bucket *b, int n, char *mem)
+// : NewBucketsnͰ,ͷŴ洢ռmem
+{
+	for (int i = 0; i < n; i++) b[i].~Bucket();		// Ͱ
+	delete []mem;
+}
+
+template <class ElemType, class KeyType>
+void CuckooHashTable<ElemType, KeyType>::Init(int nBuckets)
+// : ʼnBucketsͰĿɢб
+{
+	bucketCount = nBuckets;							// Ͱ
+	count = 0;										// Ԫظ
+	stashCount = 0;									// Ϊ
+	buckets = NewBuckets(bucketCount, storage);		// 洢ռ
+	for (int b = 0; b < bucketCount; b++)
+	{	// вÿ
+		for (int s = 0; s < CUCKOO_BUCKET_WIDTH; s++) buckets[b].full[s] = false;
+	}
+}
+
+template <class ElemType, class KeyType>
+CuckooHashTable<ElemType, KeyType>::CuckooHashTable(int size)
+// : һٿsizeԪصĿɢб,װӲ0.9
+{
+	int nBuckets = 2;
+	while (nBuckets * CUCKOO_BUCKET_WIDTH / 10 * 9 < size)
+	{	// Ͱȡ2
+		nBuckets *= 2;
+	}
+	Init(nBuckets);
+}
+
+template <class ElemType, class KeyType>
+CuckooHashTable<ElemType, KeyType>::~CuckooHashTable()
+// : ɢб
+{
+	DeleteBuckets(buckets, bucketCount, storage);	// ͷͰ
+}
+
+template <class ElemType, class KeyType>
+int CuckooHashTable<ElemType, KeyType>::Length() const
+// : Ԫظ
+{
+	return count;
+}
+
+template <class ElemType, class KeyType>
+void CuckooHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζɢбÿԪصú(*visit)
+{
+	for (int b = 0; b < bucketCount; b++)
+	{	// Ͱ
+		for (int s = 0; s < CUCKOO_BUCKET_WIDTH; s++)
+		{	// Ͱи
+			if (buckets[b].full[s]) (*visit)(buckets[b].slot[s]);
+		}
+	}
+	for (int i = 0; i < stashCount; i++)
+	{	// 
+		(*visit)(stash[i]);
+	}
+}
+
+template <class ElemType, class KeyType>
+bool CuckooHashTable<ElemType, KeyType>::SearchHelp(const KeyType &key, int &b, int &s) const
+// : ѰؼΪkeyԪصλ,ҳɹ,true,b, sͰ
+//	ۺ,ԪʱbΪ-1, sΪе;򷵻false
+{
+	int cand[2] = {H1(key), H2(key)};				// ѡͰ
+	for (int k = 0; k < 2; k++)
+	{	// βѡͰ
+		const Bucket &bucket = buckets[cand[k]];
+		for (s = 0; s < CUCKOO_BUCKET_WIDTH; s++)
+		{	// ȽͰи
+			if (bucket.full[s] && bucket.slot[s] == key)
+			{	// ҳɹ
+				b = cand[k];
+				return true;
+			}
+		}
+	}
+	for (s = 0; s < stashCount; s++)
+	{	// 
+		if (stash[s] == key)
+		{	// ҳɹ
+			b = -1;
+			return true;
+		}
+	}
+	return false;									// ʧ
+}
+
+template <class ElemType, class KeyType>
+bool CuckooHashTable<ElemType, KeyType>::FreeSlot(int b, int &s) const
+// : Ͱbпղ,sۺŲtrue,򷵻false
+{
+	for (s = 0; s < CUCKOO_BUCKET_WIDTH; s++)
+	{	// ҿղ
+		if (!buckets[b].full[s]) return true;
+	}
+	return false;
+}
+
+template <class ElemType, class KeyType>
+bool CuckooHashTable<ElemType, KeyType>::InsertHelp(const ElemType &e)
+// ʼ: ɢбвԪe
+// : Ԫe.ѡͰʱ,Ͱһ̵߳·,
+//	·ԪƵһѡͰ;Ҳ·ʱ.ɹtrue,
+//	false
+{
+	PathNode path[CUCKOO_MAX_BFS];					// 
+	int head = 0, tail = 0;							// ͷβ
+	int s;											// ۺ
+
+	path[tail].bucket = H1(e); path[tail].parent = -1; path[tail].slot = -1; tail++;
+	path[tail].bucket = H2(e); path[tail].parent = -1; path[tail].slot = -1; tail++;
+
+	while (head < tail)
+	{	// 
+		int cur = head++;							// ǰ
+		int b = path[cur].bucket;
+		if (FreeSlot(b, s))
+		{	// ҵղ,·ӺǰƶԪ
+			while (path[cur].parent != -1)
+			{	// ˫ͰеԪ뵱ǰͰ
+				const PathNode &parent = path[path[cur].parent];
+				buckets[b].slot[s] = buckets[parent.bucket].slot[path[cur].slot];
+				buckets[b].full[s] = true;
+				s = path[cur].slot;
+				cur = path[cur].parent;
+				b = parent.bucket;
+			}
+			buckets[b].slot[s] = e;					// Ԫ
+			buckets[b].full[s] = true;
+			count++;
+			return true;
+		}
+		for (s = 0; s < CUCKOO_BUCKET_WIDTH && tail < CUCKOO_MAX_BFS; s++)
+		{	// չ: ͰиԪؿһѡͰ
+			int alt = AltBucket(buckets[b].slot[s], b);
+			int anc;								// Ƚ
+			for (anc = cur; anc != -1 && path[anc].bucket != alt; anc = path[anc].parent);
+			if (anc == -1)
+			{	// ·ϲظͬһͰ
+				path[tail].bucket = alt;
+				path[tail].parent = cur;
+				path[tail].slot = s;
+				tail++;
+			}
+		}
+	}
+
+	if (stashCount < CUCKOO_STASH_SIZE)
+	{	// 
+		stash[stashCount++] = e;
+		count++;
+		return true;
+	}
+	return false;									// 
+}
+
+template <class ElemType, class KeyType>
+void CuckooHashTable<ElemType, KeyType>::Rehash(int nBuckets)
+// : ɢбؽΪnBucketsͰ,ؽʱԲʧͰټӱ
+{
+	Bucket *oldBuckets = buckets;					// ԭͰ
+	char *oldStorage = storage;						// ԭͰĴ洢ռ
+	int oldBucketCount = bucketCount;				// ԭͰ
+	ElemType oldStash[CUCKOO_STASH_SIZE];			// ԭ
+	int oldStashCount = stashCount;
+	for (int i = 0; i < stashCount; i++) oldStash[i] = stash[i];
+
+	bool success;
+	do
+	{	// ؽɢб
+		Init(nBuckets);
+		success = true;
+		for (int b = 0; b < oldBucketCount && success; b++)
+		{	// ԭͰеԪ
+			for (int s = 0; s < CUCKOO_BUCKET_WIDTH && success; s++)
+			{
+				if (oldBuckets[b].full[s]) success = InsertHelp(oldBuckets[b].slot[s]);
+			}
+		}
+		for (int i = 0; i < oldStashCount && success; i++)
+		{	// ԭеԪ
+			success = InsertHelp(oldStash[i]);
+		}
+		if (!success)
+		{	// ؽʧ,Ͱӱ
+			DeleteBuckets(buckets, bucketCount, storage);
+			nBuckets *= 2;
+		}
+	} while (!success);
+	DeleteBuckets(oldBuckets, oldBucketCount, oldStorage);	// ͷԭͰ
+}
+
+template <class ElemType, class KeyType>
+bool CuckooHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false
+{
+	int b, s;										// Ԫصλ
+	if (SearchHelp(key, b, s))
+	{	// ҳɹ
+		e = b >= 0 ? buckets[b].slot[s] : stash[s];	// eԪֵ
+		return true;								// true
+	}
+	else
+	{	// ʧ
+		return false;								// false
+	}
+}
+
+template <class ElemType, class KeyType>
+bool CuckooHashTable<ElemType, KeyType>::Insert(const ElemType &e)
+// : ɢбвԪe,ɹtrue,ԪѴڷfalse.
+//	װӳ0.9ʱͰӱ
+{
+	int b, s;										// Ԫλ
+	if (SearchHelp(e, b, s))
+	{	// ԪѴ,ʧ
+		return false;
+	}
+	if (count + 1 > bucketCount * CUCKOO_BUCKET_WIDTH / 10 * 9)
+	{	// װ,Ͱӱ
+		Rehash(2 * bucketCount);
+	}
+	while (!InsertHelp(e))
+	{	// ,Ͱӱ
+		Rehash(2 * bucketCount);
+	}
+	return true;
+}
+
+template <class ElemType, class KeyType>
+bool CuckooHashTable<ElemType, KeyType>::Delete(const KeyType &key)
+// : ɾؼΪkeyԪ,ɾɹtrue,򷵻false
+{
+	int b, s;										// Ԫλ
+	if (!SearchHelp(key, b, s))
+	{	// ɾʧ
+		return false;
+	}
+	if (b >= 0)
+	{	// Ͱ,ÿ
+		buckets[b].full[s] = false;
+	}
+	else
+	{	// ,һԪ
+		stash[s] = stash[--stashCount];
+	}
+	count--;
+	return true;
+}
+
+template <class ElemType, class KeyType>
+CuckooHashTable<ElemType, KeyType>::CuckooHashTable(const CuckooHashTable<ElemType, KeyType> &copy)
+// ɢбcopyɢбƹ캯ģ
+{
+	Init(copy.bucketCount);							// ʼɢб
+	count = copy.count;								// Ԫظ
+	stashCount = copy.stashCount;					// Ԫظ
+	for (int b = 0; b < bucketCount; b++)
+	{	// ƸͰ
+		buckets[b] = copy.buckets[b];
+	}
+	for (int i = 0; i < stashCount; i++)
+	{	// 
+		stash[i] = copy.stash[i];
+	}
+}
+
+template <class ElemType, class KeyType>
+CuckooHashTable<ElemType, KeyType> &CuckooHashTable<ElemType, KeyType>::
+operator=(const CuckooHashTable<ElemType, KeyType> &copy)
+// ɢбcopyֵǰɢбظֵ
+{
+	if (&copy != this)
+	{
+		DeleteBuckets(buckets, bucketCount, storage);	// ͷŵǰɢб洢ռ
+		Init(copy.bucketCount);						// ʼɢб
+		count = copy.count;
+		stashCount = copy.stashCount;
+		for (int b = 0; b < bucketCount; b++)
+		{	// ƸͰ
+			buckets[b] = copy.buckets[b];
+		}
+		for (int i = 0; i < stashCount; i++)
+		{	// 
+			stash[i] = copy.stash[i];
+		}
+	}
+	return *this;
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef __EXPONENTIAL_SERACH_H__
+#define __EXPONENTIAL_SERACH_H__
+
+#include "sort_compare.h"		// ȽϺ
+
+// ָ(): ʾλhint,1, 2, 4, ...ΪԾ,ֱԽ
+//	Ŀλ,һ۰.ĿhintΪdʱȽϴΪO(log d),ʺ
+//	֪λʱ,鲢ʱһжλ.ҿָȽϺcomp,Ԫذ
+//	comp
+
+template <class ElemType, class KeyType, class Compare = LessCompare>
+int GallopLowerBound(ElemType elem[], int n, KeyType key, int hint = 0,
+	Compare comp = Compare())
+// ʼ: elem[0 .. n - 1], 0 <= hint < n
+// : hint,صһСkeyԪص,Сkeyʱn
+{
+	int low, high;						// Ŀλ(low, high]
+	if (n <= 0) return 0;
+	if (comp(elem[hint], key))
+	{	// Ծ
+		int step = 1;
+		low = hint;
+		high = hint + step;
+		while (high < n && comp(elem[high], key))
+		{	// ӱ
+			low = high;
+			step *= 2;
+			high = (n - hint > step) ? hint + step : n;
+		}
+		if (high > n) high = n;
+	}
+	else
+	{	// Ծ
+		int step = 1;
+		high = hint;
+		low = hint - step;
+		while (low >= 0 && !comp(elem[low], key))
+		{	// ӱ
+			high = low;
+			step *= 2;
+			low = (hint >= step) ? hint - step : -1;
+		}
+	}
+
+	while (high - low > 1)
+	{	// ۰, elem[low] < key <= elem[high]
+		int mid = low + (high - low) / 2;
+		if (comp(elem[mid], key)) low = mid;
+		else high = mid;
+	}
+	return high;
+}
+
+template <class ElemType, class KeyType, class Compare = LessCompare>
+int GallopUpperBound(ElemType elem[], int n, KeyType key, int hint = 0,
+	Compare comp = Compare())
+// ʼ: elem[0 .. n - 1], 0 <= hint < n
+// : hint,صһkeyԪص,keyʱn
+{
+	int low, high;						// Ŀλ(low, high]
+	if (n <= 0) return 0;
+	if (!comp(key, elem[hint]))
+	{	// Ծ
+		int step = 1;
+		low = hint;
+		high = hint + step;
+		while (high < n && !comp(key, elem[high]))
+		{	// ӱ
+			low = high;
+			step *= 2;
+			high = (n - hint > step) ? hint + step : n;
+		}
+		if (high > n) high = n;
+	}
+	else
+	{	// Ծ
+		int step = 1;
+		high = hint;
+		low = hint - step;
+		while (low >= 0 && comp(key, elem[low]))
+		{	// ӱ
+			high = low;
+			step *= 2;
+			low = (hint >= step) ? hint - step : -1;
+		}
+	}
+
+	while (high - low > 1)
+	{	// ۰, elem[low] <= key < elem[high]
+		int mid = low + (high - low) / 2;
+		if (comp(key, elem[mid])) high = mid;
+		else low = mid;
+	}
+	return high;
+}
+
+template <class ElemType, class KeyType>
+int ExponentialSerach(ElemType elem[], int n, KeyType key, int hint = 0)
+// ʼ: elem[0 .. n - 1]
+// : hintвؼֵֵkeyļ¼,ҳɹ,򷵻ش˼¼
+//	,򷵻-1
+{
+	if (hint < 0) hint = 0;
+	else if (hint >= n) hint = n - 1;
+	int pos = GallopLowerBound(elem, n, key, hint);
+	if (pos < n && key == elem[pos])
+	{	// ҳɹ
+		return pos;
+	}
+	return -1;							// ʧ
+}
+
+#endif
@@ -0,0 +1,357 @@
+#ifndef __EXTERNAL_SORT_H__
+#define __EXTERNAL_SORT_H__
+
+#include "utility.h"							// ʵó
+#include "quick_sort.h"							// ʡ
+#include "min_priority_heap_queue.h"			// СȶѶ
+#include <thread>								// ̨д߳
+#include <vector>								// 鲢ļ
+#include <type_traits>							// is_trivially_copyable
+
+#define EXTERNAL_SORT_BUFFER_BYTES 1048576		// 鲢ʱÿֽ
+
+// : ļɶ¼.ȰڴԤֿ,ʡдɳʼ鲢,
+//	һ,дǰͬʱ;СȶѶжԹ鲢νж·鲢,鲢
+//	ʱֶ˹鲢.д˳,д󽻸̨߳д
+
+// ¼ģ: ļ˳¼
+template <class ElemType>
+class RecordReader
+{
+protected:
+//  ¼ݳԱ:
+	ifstream file;								// ļ
+	ElemType *buf;								// 
+	int capacity;								// 
+	int count;									// еļ¼
+	int pos;									// һ¼ڻеλ
+
+public:
+//  :
+	RecordReader();								// 캯ģ
+	~RecordReader();							// ģ
+	bool Open(const char *fileName, int bufferCount);	// ļ,bufferCount¼
+	bool Read(ElemType &e);						// һ¼
+	int ReadBlock(ElemType *dst, int maxCount);	// ֱӶmaxCount¼dst
+	void Close();								// رļ
+
+private:
+	RecordReader(const RecordReader<ElemType> &copy);	// ֹ
+	RecordReader<ElemType> &operator =(const RecordReader<ElemType> &copy);	// ֵֹ
+};
+
+// ¼дģ: ʹ,һдɺ̨߳д,ͬʱдһ
+template <class ElemType>
+class RecordWriter
+{
+protected:
+//  ¼дݳԱ:
+	ofstream file;								// ļ
+	ElemType *buf[2];							// 
+	int capacity;								// ÿ
+	int cur;									// дĻ
+	int count;									// дĻеļ¼
+	thread flusher;								// ̨д߳
+	bool failed;								// Ƿдʧ
+
+//	ģ:
+	void Flush();								// ̨߳дǰ
+
+public:
+//  :
+	RecordWriter();								// 캯ģ
+	~RecordWriter();							// ģ
+	bool Open(const char *fileName, int bufferCount);	// ļ,bufferCount¼
+	void Write(const ElemType &e);				// дһ¼
+	bool Close();								// дʣ¼رļ,ɹtrue
+
+private:
+	RecordWriter(const RecordWriter<ElemType> &copy);	// ֹ
+	RecordWriter<ElemType> &operator =(const RecordWriter<ElemType> &copy);	// ֵֹ
+};
+
+// 鲢ʱеԪ: ¼ڵĹ鲢
+template <class ElemType>
+struct ExternalMergeItem
+{
+	ElemType e;									// ¼
+	int run;									// ڹ鲢
+};
+
+template <class ElemType>
+bool operator <(const ExternalMergeItem<ElemType> &first, const ExternalMergeItem<ElemType> &second)
+// : ¼Ƚ,¼ʱСĹ鲢ǰ
+{
+	if (first.e < second.e) return true;
+	if (second.e < first.e) return false;
+	return first.run < second.run;
+}
+
+template <class ElemType>
+bool operator >(const ExternalMergeItem<ElemType> &first, const ExternalMergeItem<ElemType> &second)
+// : عϵ>
+{
+	return second < first;
+}
+
+template <class ElemType>
+bool operator <=(const ExternalMergeItem<ElemType> &first, const ExternalMergeItem<ElemType> &second)
+// : عϵ<=
+{
+	return !(second < first);
+}
+
+template <class ElemType>
+bool operator >=(const ExternalMergeItem<ElemType> &first, const ExternalMergeItem<ElemType> &second)
+// : عϵ>=
+{
+	return !(first < second);
+}
+
+// ¼ģʵֲ
+template <class ElemType>
+RecordReader<ElemType>::RecordReader()
+// : δļĶ
+{
+	buf = NULL;
+	capacity = count = pos = 0;
+}
+
+template <class ElemType>
+RecordReader<ElemType>::~RecordReader()
+// : رļ
+{
+	Close();
+}
+
+template <class ElemType>
+bool RecordReader<ElemType>::Open(const char *fileName, int bufferCount)
+// : ԶƷʽļfileName,ɹtrue,򷵻false
+{
+	Close();
+	file.open(fileName, ios::binary);
+	if (!file) return false;
+	capacity = bufferCount > 0 ? bufferCount : 1;
+	buf = new ElemType[capacity];
+	count = pos = 0;
+	return true;
+}
+
+template <class ElemType>
+bool RecordReader<ElemType>::Read(ElemType &e)
+// : һ¼e,ļѶʱfalse
+{
+	if (pos == count)
+	{	// ѿ,һ
+		file.read((char *)buf, (streamsize)capacity * sizeof(ElemType));
+		count = (int)(file.gcount() / sizeof(ElemType));
+		pos = 0;
+		if (count == 0) return false;
+	}
+	e = buf[pos++];
+	return true;
+}
+
+template <class ElemType>
+int RecordReader<ElemType>::ReadBlock(ElemType *dst, int maxCount)
+// : maxCount¼dst,ضļ¼
+{
+	int n = 0;
+	while (pos < count && n < maxCount) dst[n++] = buf[pos++];	// ȡеļ¼
+	if (n < maxCount)
+	{	// ֱӴļ
+		file.read((char *)(dst + n), (streamsize)(maxCount - n) * sizeof(ElemType));
+		n += (int)(file.gcount() / sizeof(ElemType));
+	}
+	return n;
+}
+
+template <class ElemType>
+void RecordReader<ElemType>::Close()
+// : رļ,ͷŻ
+{
+	if (file.is_open()) file.close();
+	delete []buf;
+	buf = NULL;
+	capacity = count = pos = 0;
+}
+
+// ¼дģʵֲ
+template <class ElemType>
+RecordWriter<ElemType>::RecordWriter()
+// : δļд
+{
+	buf[0] = buf[1] = NULL;
+	capacity = cur = count = 0;
+	failed = false;
+}
+
+template <class ElemType>
+RecordWriter<ElemType>::~RecordWriter()
+// : дʣ¼رļ
+{
+	Close();
+}
+
+template <class ElemType>
+bool RecordWriter<ElemType>::Open(const char *fileName, int bufferCount)
+// : ԶƷʽļfileName,ɹtrue,򷵻false
+{
+	Close();
+	file.open(fileName, ios::binary | ios::trunc);
+	if (!file) return false;
+	capacity = bufferCount > 0 ? bufferCount : 1;
+	buf[0] = new ElemType[capacity];
+	buf[1] = new ElemType[capacity];
+	cur = count = 0;
+	failed = false;
+	return true;
+}
+
+template <class ElemType>
+void RecordWriter<ElemType>::Flush()
+// : ȴһд,ɺ̨߳дǰ,һ
+{
+	if (flusher.joinable()) flusher.join();
+	if (!file) failed = true;
+	const char *data = (const char *)buf[cur];
+	streamsize bytes = (streamsize)count * sizeof(ElemType);
+	flusher = thread([this, data, bytes]()
+	{	// ̨д
+		file.write(data, bytes);
+	});
+	cur = 1 - cur;
+	count = 0;
+}
+
+template <class ElemType>
+void RecordWriter<ElemType>::Write(const ElemType &e)
+// : д¼e
+{
+	buf[cur][count++] = e;
+	if (count == capacity) Flush();
+}
+
+template <class ElemType>
+bool RecordWriter<ElemType>::Close()
+// : дʣ¼رļ,ȫдɹtrue,򷵻false
+{
+	if (buf[0] == NULL) return !failed;			// δ
+	if (count > 0) Flush();
+	if (flusher.joinable()) flusher.join();
+	if (!file) failed = true;
+	file.close();
+	delete []buf[0];
+	delete []buf[1];
+	buf[0] = buf[1] = NULL;
+	return !failed;
+}
+
+// ģ
+template <class ElemType>
+bool ExternalMergeRuns(const vector<string> &runs, int first, int last, const char *outFileName,
+	int bufferCount)
+// : 鲢runs[first .. last - 1]·鲢ļoutFileName,ɹtrue
+{
+	int k = last - first;						// 鲢·
+	RecordReader<ElemType> *reader = new RecordReader<ElemType>[k];	// 鲢εĶ
+	MinPriorityHeapQueue<ExternalMergeItem<ElemType> > heap(k);	// εǰС¼
+	RecordWriter<ElemType> writer;				// 
+	bool ok = writer.Open(outFileName, bufferCount);
+
+	for (int i = 0; ok && i < k; i++)
+	{	// ׼¼
+		ExternalMergeItem<ElemType> item;
+		item.run = i;
+		ok = reader[i].Open(runs[first + i].c_str(), bufferCount);
+		if (ok && reader[i].Read(item.e)) heap.InQueue(item);
+	}
+
+	ExternalMergeItem<ElemType> item;
+	while (ok && heap.OutQueue(item) == SUCCESS)
+	{	// С¼,ͬһεһ¼
+		writer.Write(item.e);
+		if (reader[item.run].Read(item.e)) heap.InQueue(item);
+	}
+	if (!writer.Close()) ok = false;
+	delete []reader;
+	return ok;
+}
+
+template <class ElemType>
+bool ExternalSort(const char *inFileName, const char *outFileName, long long memoryBytes)
+// ʼ: ElemTypeΪɰλƵĶ¼,<
+// : ļinFileNameеļ¼,дļoutFileName,ڴԼΪ
+//	memoryBytesֽ,ʱ鲢ļoutFileNameԱ,ʱɾ.ɹtrue,
+//	򷵻false
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "¼ɰλ");
+	int bufferCount = (int)(EXTERNAL_SORT_BUFFER_BYTES / sizeof(ElemType));	// ÿļ¼
+	if (bufferCount < 1) bufferCount = 1;
+	long long chunkLong = memoryBytes / 2 / (long long)sizeof(ElemType);	// ÿ¼,齻
+	int chunk = chunkLong > numeric_limits<int>::max() ? numeric_limits<int>::max() : (int)chunkLong;
+	if (chunk < bufferCount) chunk = bufferCount;
+	int fanIn = (int)(memoryBytes / EXTERNAL_SORT_BUFFER_BYTES) - 2;	// ÿ˹鲢·
+	if (fanIn < 2) fanIn = 2;
+
+	vector<string> runs;						// 鲢ļ
+	bool ok = true;
+	{	// ɳʼ鲢:̶̨߳һʱ,߳дǰ
+		RecordReader<ElemType> reader;
+		if (!reader.Open(inFileName, 1)) return false;
+		ElemType *block[2] = {new ElemType[chunk], new ElemType[chunk]};	// 齻
+		int cur = 0;
+		int n = reader.ReadBlock(block[cur], chunk);	// ǰ¼
+		while (ok && n > 0)
+		{	// ǰ
+			int next = 0;						// һ¼
+			thread loader([&reader, &block, &next, cur, chunk]()
+			{	// ̨һ
+				next = reader.ReadBlock(block[1 - cur], chunk);
+			});
+			IntroSort(block[cur], n);
+			string name = string(outFileName) + ".run" + to_string(runs.size());
+			ofstream runFile(name.c_str(), ios::binary | ios::trunc);
+			runFile.write((const char *)block[cur], (streamsize)n * sizeof(ElemType));
+			ok = (bool)runFile;
+			runFile.close();
+			runs.push_back(name);
+			loader.join();
+			cur = 1 - cur;
+			n = next;
+		}
+		delete []block[0];
+		delete []block[1];
+	}
+
+	int pass = 0;								// 鲢
+	while (ok && (int)runs.size() > fanIn)
+	{	// 鲢ι,ÿfanIn鲢Ϊһ
+		vector<string> merged;
+		for (int first = 0; ok && first < (int)runs.size(); first += fanIn)
+		{	// 鲢runs[first .. last - 1]
+			int last = (int)runs.size() - first > fanIn ? first + fanIn : (int)runs.size();
+			string name = string(outFileName) + ".pass" + to_string(pass) + "." +
+				to_string(merged.size());
+			ok = ExternalMergeRuns<ElemType>(runs, first, last, name.c_str(), bufferCount);
+			merged.push_back(name);
+		}
+		for (int i = 0; i < (int)runs.size(); i++) remove(runs[i].c_str());
+		runs = merged;
+		pass++;
+	}
+
+	if (ok && runs.empty())
+	{	// ļΪ
+		ofstream outFile(outFileName, ios::binary | ios::trunc);
+		ok = (bool)outFile;
+	}
+	else if (ok)
+	{	// һ˹鲢ļ
+		ok = ExternalMergeRuns<ElemType>(runs, 0, (int)runs.size(), outFileName, bufferCount);
+	}
+	for (int i = 0; i < (int)runs.size(); i++) remove(runs[i].c_str());
+	return ok;
+}
+
+#endif
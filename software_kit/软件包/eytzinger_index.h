@@ -0,0 +1,126 @@
+#ifndef __EYTZINGER_INDEX_H__
+#define __EYTZINGER_INDEX_H__
+
+#include "utility.h"							// ʵó
+#include "simd_support.h"						// SIMDָ֧
+
+// Eytzingerģ: ȫĲδ,kĺΪ2k2k + 1,
+//	·ϵĽ㼯ǰ,ҿǰԤȡɲ֮Ľ,۰ҵĻʸ,
+//	½̲֧
+template <class ElemType>
+class EytzingerIndex
+{
+protected:
+//  EytzingerݳԱ:
+	ElemType *storage;							// Ĵ洢ռ
+	ElemType *b;								// δŵԪ,b[1]Ϊ,ʼڻб߽
+	int *index;									// index[k]Ϊb[k]ԭе
+	int n;										// Ԫظ
+
+//	ģ:
+	int Build(const ElemType elem[], int i, int k);	// ԭelem[i ..]kΪ
+	template <class KeyType>
+	int Descend(const KeyType &key) const;		// һСkeyԪbеλ
+
+public:
+//  Eytzinger:
+	EytzingerIndex(const ElemType elem[], int cnt);	// elem[0 .. cnt - 1]
+	~EytzingerIndex();							// ģ
+	int Length() const;							// Ԫظ
+	template <class KeyType>
+	int Search(const KeyType &key) const;		// ҹؼֵkeyԪԭе
+	template <class KeyType>
+	int LowerBound(const KeyType &key) const;	// һСkeyԪԭе
+
+private:
+	EytzingerIndex(const EytzingerIndex<ElemType> &copy);	// ֹ
+	EytzingerIndex<ElemType> &operator=(const EytzingerIndex<ElemType> &copy);	// ֵֹ
+};
+
+// Eytzingerģʵֲ
+template <class ElemType>
+int EytzingerIndex<ElemType>::Build(const ElemType elem[], int i, int k)
+// : elem[i ..]kΪ,һδԪص±
+{
+	if (k <= n)
+	{	// ǿ
+		i = Build(elem, i, 2 * k);				// 
+		b[k] = elem[i];							// 
+		index[k] = i++;
+		i = Build(elem, i, 2 * k + 1);			// 
+	}
+	return i;
+}
+
+template <class ElemType>
+EytzingerIndex<ElemType>::EytzingerIndex(const ElemType elem[], int cnt)
+// : elem[0 .. cnt - 1]
+{
+	int perLine = CACHE_LINE_SIZE / sizeof(ElemType) > 0 ? CACHE_LINE_SIZE / sizeof(ElemType) : 1;
+		// һеԪظ
+	n = cnt;
+	storage = new ElemType[n + 1 + perLine];	// һڶ
+	b = storage;
+	while ((size_t)b % CACHE_LINE_SIZE != 0 && b < storage + perLine)
+	{	// ʹb[0]λڻб߽,Ӷÿͬλͬһ
+		b++;
+	}
+	index = new int[n + 1];
+	index[0] = n;								// ڲСkeyԪʱ
+	Build(elem, 0, 1);
+}
+
+template <class ElemType>
+EytzingerIndex<ElemType>::~EytzingerIndex()
+// : 
+{
+	delete []storage;
+	delete []index;
+}
+
+template <class ElemType>
+int EytzingerIndex<ElemType>::Length() const
+// : Ԫظ
+{
+	return n;
+}
+
+template <class ElemType>
+template <class KeyType>
+int EytzingerIndex<ElemType>::Descend(const KeyType &key) const
+// : صһСkeyԪbеλ,ʱ0
+{
+	int perLine = CACHE_LINE_SIZE / sizeof(ElemType) > 0 ? CACHE_LINE_SIZE / sizeof(ElemType) : 1;
+	unsigned int k = 1;							// ǰ
+	while (k <= (unsigned int)n)
+	{	// ޷֧½: СkeyʱҺ,
+		PREFETCH(b + (unsigned long long)k * perLine);	// Ԥȡɲ֮ͬһеȫ
+		k = 2 * k + (b[k] < key);
+	}
+	k >>= LowestBitIndex(~k) + 1;				// ȥĩβ1ǰһ0,صһתĽ
+	return (int)k;
+}
+
+template <class ElemType>
+template <class KeyType>
+int EytzingerIndex<ElemType>::Search(const KeyType &key) const
+// : ҹؼֵֵkeyļ¼,ҳɹ,򷵻ش˼¼ԭе,
+//	򷵻-1.LowerBound,ظԪʱصһ
+{
+	int k = Descend(key);
+	if (k != 0 && b[k] == key)
+	{	// ҳɹ
+		return index[k];
+	}
+	return -1;									// ʧ
+}
+
+template <class ElemType>
+template <class KeyType>
+int EytzingerIndex<ElemType>::LowerBound(const KeyType &key) const
+// : ԭеһСkeyԪص,Сkeyʱn
+{
+	return index[Descend(key)];
+}
+
+#endif
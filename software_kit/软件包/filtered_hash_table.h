@@ -0,0 +1,115 @@
+#ifndef __FILTERED_HASH_TABLE_H__
+#define __FILTERED_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+#include "hash_table.h"								// ɢб
+#include "counting_bloom_filter.h"					// ¡
+
+// ɢбģ: ǰȲ¡,ȷڵĹؼֲ̽ɢб,
+//	ͳʵʹÿؼֵλ
+template <class ElemType, class KeyType>
+class FilteredHashTable
+{
+protected:
+//  ɢбݳԱ:
+	HashTable<ElemType, KeyType> table;				// ɢб
+	CountingBloomFilter<KeyType> filter;			// 
+	mutable long long rejected;						// 񶨵ĲҴ
+	mutable long long falsePositives;				// еĲҴ
+
+public:
+//  ɢб:
+	FilteredHashTable(int size, int divisor, double bitsPerKey = 10);	// 캯ģ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Insert(const ElemType &e);					// Ԫe
+	bool Delete(const KeyType &key);				// ɾؼΪkeyԪ
+	double BitsPerKey() const;						// ÿؼռλ,
+	double FalsePositiveRate() const;				// ʧʱʵ
+	void ResetStatistics();							// ͳ
+};
+
+// ɢбģʵֲ
+template <class ElemType, class KeyType>
+FilteredHashTable<ElemType, KeyType>::FilteredHashTable(int size, int divisor, double bitsPerKey):
+	table(size, divisor), filter(size, bitsPerKey)
+// : sizeΪɢб, divisorΪĳһյɢ,
+//	ÿؼbitsPerKeyλ
+{
+	rejected = 0;
+	falsePositives = 0;
+}
+
+template <class ElemType, class KeyType>
+void FilteredHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζɢбÿԪصú(*visit)
+{
+	table.Traverse(visit);
+}
+
+template <class ElemType, class KeyType>
+bool FilteredHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false
+{
+	if (!filter.MayContain(key))
+	{	// ȷ
+		rejected++;
+		return false;
+	}
+	if (table.Search(key, e))
+	{	// ҳɹ
+		return true;
+	}
+	falsePositives++;								// 
+	return false;
+}
+
+template <class ElemType, class KeyType>
+bool FilteredHashTable<ElemType, KeyType>::Insert(const ElemType &e)
+// : ɢбвԪe,ɹtrue,򷵻false
+{
+	if (table.Insert(e))
+	{	// ɹ,ͬʱ
+		filter.Insert(e);
+		return true;
+	}
+	return false;
+}
+
+template <class ElemType, class KeyType>
+bool FilteredHashTable<ElemType, KeyType>::Delete(const KeyType &key)
+// : ɾؼΪkeyԪ,ɾɹtrue,򷵻false
+{
+	if (table.Delete(key))
+	{	// ɾɹ,ͬʱӹɾ
+		filter.Delete(key);
+		return true;
+	}
+	return false;
+}
+
+template <class ElemType, class KeyType>
+double FilteredHashTable<ElemType, KeyType>::BitsPerKey() const
+// : عÿؼռλ,λ4λ,ԼΪλ5
+{
+	return filter.BitsPerKey();
+}
+
+template <class ElemType, class KeyType>
+double FilteredHashTable<ElemType, KeyType>::FalsePositiveRate() const
+// : زʧʱδܷ񶨵ı
+{
+	long long misses = rejected + falsePositives;	// ʧܴ
+	return misses == 0 ? 0 : (double)falsePositives / misses;
+}
+
+template <class ElemType, class KeyType>
+void FilteredHashTable<ElemType, KeyType>::ResetStatistics()
+// : ͳ
+{
+	rejected = 0;
+	falsePositives = 0;
+}
+
+#endif
@@ -0,0 +1,337 @@
+#ifndef __FLAT_HASH_TABLE_H__
+#define __FLAT_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+#include "simd_support.h"							// SIMDָ֧
+
+// ֽڵȡֵ: ǸֵΪռò۵ɢֵ7λ
+#define FLAT_CTRL_EMPTY ((signed char)-128)			// ղ
+#define FLAT_CTRL_DELETED ((signed char)-2)			// ɾ
+#define FLAT_GROUP_WIDTH 16							// ÿ̽һ
+
+// ̽ɢбģ
+template <class ElemType, class KeyType>
+class FlatHashTable
+{
+protected:
+//  ɢбݳԱ:
+	ElemType *ht;									// ɢб
+	signed char *ctrl;								// ֽ,ĩβǰFLAT_GROUP_WIDTH
+	int m;											// ɢб,Ϊ2
+	int count;										// Ԫظ
+	int deleted;									// ɾ۸
+
+//	ģ:
+	static unsigned long long H(const KeyType &key);// ɢкģ
+	unsigned int MatchGroup(int pos, signed char c) const;
+		// شposʼһֽеcλ
+	unsigned int MatchFree(int pos) const;			// شposʼһпղۻɾ۵λ
+	void SetCtrl(int pos, signed char c);			// ÿֽ
+	bool SearchHelp(const KeyType &key, int &pos) const;	// ѰؼΪkeyԪصλ
+	int FreePos(unsigned long long h) const;		// ɢֵΪhԪصĲλ
+	void Init(int size);							// ʼΪsizeĿɢб
+	void Rehash(int size);							// ɢбؽΪsize
+
+public:
+//  ɢбرϵͳĬϷ:
+	FlatHashTable(int size = DEFAULT_SIZE);			// 캯ģ
+	~FlatHashTable();								// 캯ģ
+	int Length() const;								// Ԫظ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Insert(const ElemType &e);					// Ԫe
+	bool Delete(const KeyType &key);				// ɾؼΪkeyԪ
+	FlatHashTable(const FlatHashTable<ElemType, KeyType> &copy);	// ƹ캯ģ
+	FlatHashTable<ElemType, KeyType> &operator=
+		(const FlatHashTable<ElemType, KeyType> &copy);	// ظֵ
+};
+
+// ̽ɢбģʵֲ
+template <class ElemType, class KeyType>
+unsigned long long FlatHashTable<ElemType, KeyType>::H(const KeyType &key)
+// : ɢֵ,7λֽ,λȷ̽ʼַ
+{
+	return HashMix((unsigned long long)key);
+}
+
+template <class ElemType, class KeyType>
+unsigned int FlatHashTable<ElemType, KeyType>::MatchGroup(int pos, signed char c) const
+// : ctrl[pos .. pos + FLAT_GROUP_WIDTH - 1]еcλ,iλӦctrl[pos + i]
+{
+#ifdef SIMD_SSE2
+	__m128i group = _mm_loadu_si128((const __m128i *)(ctrl + pos));	// һζ16ֽ
+	return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(c)));
+#else
+	unsigned int mask = 0;
+	for (int i = 0; i < FLAT_GROUP_WIDTH; i++)
+	{	// ȽϿֽ
+		if (ctrl[pos + i] == c) mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
+
+template <class ElemType, class KeyType>
+unsigned int FlatHashTable<ElemType, KeyType>::MatchFree(int pos) const
+// : ctrl[pos .. pos + FLAT_GROUP_WIDTH - 1]пղۻɾ(ֽΪ)λ
+{
+#ifdef SIMD_SSE2
+	__m128i group = _mm_loadu_si128((const __m128i *)(ctrl + pos));
+	return (unsigned int)_mm_movemask_epi8(group);	// ȡֽڵķλ
+#else
+	unsigned int mask = 0;
+	for (int i = 0; i < FLAT_GROUP_WIDTH; i++)
+	{	// ֽڵķ
+		if (ctrl[pos + i] < 0) mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
+
+template <class ElemType, class KeyType>
+void FlatHashTable<ElemType, KeyType>::SetCtrl(int pos, signed char c)
+// : ctrl[pos]Ϊc,posλǰFLAT_GROUP_WIDTH,ͬʱ޸ĩβĸ
+{
+	ctrl[pos] = c;
+	if (pos < FLAT_GROUP_WIDTH)
+	{	// ά,ʹλÿʼһֽڶ
+		ctrl[m + pos] = c;
+	}
+}
+
+template <class ElemType, class KeyType>
+void FlatHashTable<ElemType, KeyType>::Init(int size)
+// : ʼΪsizeĿɢб
+{
+	m = size;										// ɢб
+	count = 0;										// ɢбԪظΪ0
+	deleted = 0;									// ɾ
+	ht = new ElemType[m];							// 洢ռ
+	ctrl = new signed char[m + FLAT_GROUP_WIDTH];	// 洢ռ
+	for (int pos = 0; pos < m + FLAT_GROUP_WIDTH; pos++)
+	{	// вÿ
+		ctrl[pos] = FLAT_CTRL_EMPTY;
+	}
+}
+
+template <class ElemType, class KeyType>
+FlatHashTable<ElemType, KeyType>::FlatHashTable(int size)
+// : һٿsizeԪصĿɢб,װӲ7/8
+{
+	int capacity = FLAT_GROUP_WIDTH;
+	while (capacity / 8 * 7 < size)
+	{	// ȡ2
+		capacity *= 2;
+	}
+	Init(capacity);
+}
+
+template <class ElemType, class KeyType>
+FlatHashTable<ElemType, KeyType>::~FlatHashTable()
+// : ɢб
+{
+	delete []ht;									// ͷht
+	delete []ctrl;									// ͷctrl
+}
+
+template <class ElemType, class KeyType>
+int FlatHashTable<ElemType, KeyType>::Length() const
+// : Ԫظ
+{
+	return count;
+}
+
+template <class ElemType, class KeyType>
+void FlatHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζɢбÿԪصú(*visit)
+{
+	for (int pos = 0; pos < m; pos++)
+	{	// ɢбÿԪصú(*visit)
+		if (ctrl[pos] >= 0)
+		{	// Ԫطǿ
+			(*visit)(ht[pos]);
+		}
+	}
+}
+
+template <class ElemType, class KeyType>
+bool FlatHashTable<ElemType, KeyType>::SearchHelp(const KeyType &key, int &pos) const
+// : ѰؼΪkeyԪصλ,ҳɹ,true,posָʾ
+//	Ԫɢбλ,򷵻false.ÿαȽһֽ,ֻе7λɢֵͬĲ
+//	űȽԪر,ղ۵鼴жʧ
+{
+	unsigned long long h = H(key);					// ɢֵ
+	signed char fragment = (signed char)(h & 0x7F);	// ɢֵ7λ
+	int mask = m - 1;
+	int group = (int)(h >> 7) & mask;				// һʼַ
+
+	for (int step = FLAT_GROUP_WIDTH; step <= m; step += FLAT_GROUP_WIDTH)
+	{	// ̽,m / FLAT_GROUP_WIDTH
+		unsigned int match = MatchGroup(group, fragment);
+		while (match != 0)
+		{	// Ƚϵ7λɢֵͬĲ
+			int cur = (group + LowestBitIndex(match)) & mask;
+			if (ht[cur] == key)
+			{	// ҳɹ
+				pos = cur;
+				return true;
+			}
+			match &= match - 1;						// ȥ͵1λ
+		}
+		if (MatchGroup(group, FLAT_CTRL_EMPTY) != 0)
+		{	// пղ,ʧ
+			return false;
+		}
+		group = (group + step) & mask;				// һʼַ
+	}
+	return false;									// ʧ
+}
+
+template <class ElemType, class KeyType>
+int FlatHashTable<ElemType, KeyType>::FreePos(unsigned long long h) const
+// ʼ: ɢбдڿղۻɾ
+// : SearchHelpͬ̽,صһղۻɾ۵λ
+{
+	int mask = m - 1;
+	int group = (int)(h >> 7) & mask;
+
+	for (int step = FLAT_GROUP_WIDTH; ; step += FLAT_GROUP_WIDTH)
+	{	// ̽
+		unsigned int free = MatchFree(group);
+		if (free != 0)
+		{	// пõĲ
+			return (group + LowestBitIndex(free)) & mask;
+		}
+		group = (group + step) & mask;
+	}
+}
+
+template <class ElemType, class KeyType>
+void FlatHashTable<ElemType, KeyType>::Rehash(int size)
+// : ɢбؽΪsize,ͬʱɾ
+{
+	ElemType *oldHt = ht;							// ԭɢб
+	signed char *oldCtrl = ctrl;					// ԭֽ
+	int oldM = m;									// ԭ
+
+	Init(size);										// ʼɢб
+	for (int pos = 0; pos < oldM; pos++)
+	{	// ԭɢбԪزɢб
+		if (oldCtrl[pos] >= 0)
+		{	// Ԫطǿ
+			unsigned long long h = H(oldHt[pos]);
+			int cur = FreePos(h);
+			ht[cur] = oldHt[pos];
+			SetCtrl(cur, (signed char)(h & 0x7F));
+			count++;
+		}
+	}
+	delete []oldHt;									// ͷԭɢб
+	delete []oldCtrl;								// ͷԭֽ
+}
+
+template <class ElemType, class KeyType>
+bool FlatHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false
+{
+	int pos;										// Ԫصλ
+	if (SearchHelp(key, pos))
+	{	// ҳɹ
+		e = ht[pos];								// eԪֵ
+		return true;								// true
+	}
+	else
+	{	// ʧ
+		return false;								// false
+	}
+}
+
+template <class ElemType, class KeyType>
+bool FlatHashTable<ElemType, KeyType>::Insert(const ElemType &e)
+// : ɢбвԪe,ɹtrue,ԪѴڷfalse.
+//	ռòɾ۳7/8ʱؽɢб
+{
+	int pos;										// λ
+	if (SearchHelp(e, pos))
+	{	// ԪѴ,ʧ
+		return false;
+	}
+
+	if ((count + deleted + 1) > m / 8 * 7)
+	{	// װ
+		Rehash((count + 1) > m / 16 * 7 ? 2 * m : m);	// Ԫؽ϶ʱ,ֻɾ
+	}
+
+	unsigned long long h = H(e);					// ɢֵ
+	pos = FreePos(h);
+	if (ctrl[pos] == FLAT_CTRL_DELETED)
+	{	// ɾ
+		deleted--;
+	}
+	ht[pos] = e;									// Ԫ
+	SetCtrl(pos, (signed char)(h & 0x7F));			// ¼ɢֵ7λ
+	count++;
+	return true;
+}
+
+template <class ElemType, class KeyType>
+bool FlatHashTable<ElemType, KeyType>::Delete(const KeyType &key)
+// : ɾؼΪkeyԪ,ɾɹtrue,򷵻false
+{
+	int pos;										// Ԫλ
+	if (SearchHelp(key, pos))
+	{	// ɾɹ
+		SetCtrl(pos, FLAT_CTRL_DELETED);			// Ϊɾ,ʹ̽вж
+		count--;
+		deleted++;
+		return true;
+	}
+	else
+	{	// ɾʧ
+		return false;
+	}
+}
+
+template <class ElemType, class KeyType>
+FlatHashTable<ElemType, KeyType>::FlatHashTable(const FlatHashTable<ElemType, KeyType> &copy)
+// ɢбcopyɢбƹ캯ģ
+{
+	Init(copy.m);									// ʼɢб
+	count = copy.count;								// Ԫظ
+	deleted = copy.deleted;							// ɾ۸
+	for (int pos = 0; pos < m; pos++)
+	{	// Ԫ
+		ht[pos] = copy.ht[pos];
+	}
+	for (int pos = 0; pos < m + FLAT_GROUP_WIDTH; pos++)
+	{	// ƿֽ
+		ctrl[pos] = copy.ctrl[pos];
+	}
+}
+
+template <class ElemType, class KeyType>
+FlatHashTable<ElemType, KeyType> &FlatHashTable<ElemType, KeyType>::
+operator=(const FlatHashTable<ElemType, KeyType> &copy)
+// ɢбcopyֵǰɢбظֵ
+{
+	if (&copy != this)
+	{
+		delete []ht;								// ͷŵǰɢб洢ռ
+		delete []ctrl;
+		Init(copy.m);								// ʼɢб
+		count = copy.count;
+		deleted = copy.deleted;
+		for (int pos = 0; pos < m; pos++)
+		{	// Ԫ
+			ht[pos] = copy.ht[pos];
+		}
+		for (int pos = 0; pos < m + FLAT_GROUP_WIDTH; pos++)
+		{	// ƿֽ
+			ctrl[pos] = copy.ctrl[pos];
+		}
+	}
+	return *this;
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef __HASH_TABLE_H__
 #define __HASH_TABLE_H__
 
+#include "snapshot.h"							// ļ
+
 // ɢбģ
 template <class ElemType, class KeyType>
 class HashTable
@@ -25,6 +27,7 @@ public:
 	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
 	bool Insert(const ElemType &e);				// Ԫe
 	bool Delete(const KeyType &key);			// ɾؼΪkeyԪ
+	bool Save(const char *fileName) const;		// ɢбдļ
     HashTable(const HashTable<ElemType, KeyType> &copy);	// ƹ캯ģ
     HashTable<ElemType, KeyType> &operator=
 		(const HashTable<ElemType, KeyType> &copy);			// ظֵ
@@ -156,6 +159,24 @@ bool HashTable<ElemType, KeyType>::Delete(const KeyType &key)
 	}
 }
 
+template <class ElemType, class KeyType>
+bool HashTable<ElemType, KeyType>::Save(const char *fileName) const
+// : ɢбдļfileName,HashTableViewӳֱӲ,ɹ
+//	true,򷵻false
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "Ԫɰֽڸ");
+
+	SnapshotHeader header;						// ļͷ
+	InitSnapshotHeader(header, SNAPSHOT_HASH_TABLE, (int)sizeof(ElemType));
+	header.param[0] = m;						// ɢб
+	header.param[1] = p;						// ĳ
+	header.sectionCount = 2;
+	header.length[0] = (long long)m * sizeof(ElemType);
+	header.length[1] = (long long)m * sizeof(bool);
+	const void *section[2] = {ht, empty};		// ɢбԪر־
+	return SaveSnapshot(fileName, header, section);
+}
+
 template <class ElemType, class KeyType>
 HashTable<ElemType, KeyType>::HashTable(const HashTable<ElemType, KeyType> &copy)
 // ɢбcopyɢбƹ캯ģ
@@ -0,0 +1,143 @@
+#ifndef __HASH_TABLE_VIEW_H__
+#define __HASH_TABLE_VIEW_H__
+
+#include "snapshot_file.h"								// ӳĿļ
+
+// ɢбͼģ: ӳHashTable::SaveдĿļ,ֱӳв,
+//	Ԫ,Ҳؽɢб,ҳ״ηʱȱҳжϵ
+template <class ElemType, class KeyType>
+class HashTableView
+{
+protected:
+//  ɢбͼݳԱ:
+	SnapshotFile file;								// ӳĿļ
+	const ElemType *ht;								// ɢб
+	const bool *empty;								// Ԫ
+	int m;											// ɢб
+	int p;											// ĳ
+
+//	ģ:
+	int H(KeyType key) const;						// ɢкģ
+	int Collision(KeyType key, int i) const;		// ͻĺģ
+	bool SearchHelp(const KeyType &key, int &pos) const;	// ѰؼΪkeyԪصλ
+
+public:
+//  ɢбͼ:
+	HashTableView();								// 캯ģ
+	bool Open(const char *fileName, bool verify = false);	// ӳļ
+	void Close();									// ӳ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+};
+
+// ɢбͼģʵֲ
+template <class ElemType, class KeyType>
+int HashTableView<ElemType, KeyType>::H(KeyType key) const
+// : ɢеַ,HashTableͬ
+{
+	return key % p;
+}
+
+template <class ElemType, class KeyType>
+int HashTableView<ElemType, KeyType>::Collision(KeyType key, int i) const
+// : صiγͻַ̽,HashTableͬ
+{
+	return (H(key) + i) % m;
+}
+
+template <class ElemType, class KeyType>
+HashTableView<ElemType, KeyType>::HashTableView()
+// : δӳκļͼ
+{
+	ht = NULL;
+	empty = NULL;
+	m = 0;
+	p = 1;
+}
+
+template <class ElemType, class KeyType>
+bool HashTableView<ElemType, KeyType>::Open(const char *fileName, bool verify)
+// : ӳļfileName,ɹtrue,ļڻԪͬɢб
+//	ʱfalse.verifyΪtrueʱȫݵУ
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "Ԫɰֽڸ");
+
+	Close();
+	if (!file.Open(fileName, SNAPSHOT_HASH_TABLE, (int)sizeof(ElemType), verify)) return false;
+	const SnapshotHeader *header = file.Header();
+	if (header->sectionCount != 2 ||
+		header->param[0] > numeric_limits<int>::max() ||
+		header->param[1] <= 0 || header->param[1] > header->param[0] ||
+		header->length[0] != header->param[0] * (long long)sizeof(ElemType) ||
+		header->length[1] != header->param[0] * (long long)sizeof(bool))
+	{	// (0, ],鳤,HCollision0Խ
+		file.Close();
+		return false;
+	}
+	m = (int)header->param[0];						// ɢб
+	p = (int)header->param[1];						// ĳ
+	ht = (const ElemType *)file.Section(0);
+	empty = (const bool *)file.Section(1);
+	return true;
+}
+
+template <class ElemType, class KeyType>
+void HashTableView<ElemType, KeyType>::Close()
+// : ӳ
+{
+	file.Close();
+	ht = NULL;
+	empty = NULL;
+	m = 0;
+	p = 1;
+}
+
+template <class ElemType, class KeyType>
+void HashTableView<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζɢбÿԪصú(*visit)
+{
+	for (int pos = 0; pos < m; pos++)
+	{	// ɢбÿԪصú(*visit)
+		if (!empty[pos])
+		{	// Ԫطǿ
+			(*visit)(ht[pos]);
+		}
+	}
+}
+
+template <class ElemType, class KeyType>
+bool HashTableView<ElemType, KeyType>::SearchHelp(const KeyType &key, int &pos) const
+// : ѰؼΪkeyԪصλ,̽HashTableͬ
+{	
+	if (m == 0) return false;			// δӳļ
+	int c = 0;							// ͻ
+	pos = H(key);						// ɢбַ
+
+	while (c < m &&						// ͻӦСm
+		!empty[pos] &&					// Ԫht[pos]ǿ
+		ht[pos] != key)					// ؼֵ
+	{	
+		pos = Collision(key, ++c);		//һַ̽
+	}
+
+	return c < m && !empty[pos];
+}
+
+template <class ElemType, class KeyType>
+bool HashTableView<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false
+{
+	int pos;							// Ԫصλ
+	if (SearchHelp(key, pos))
+	{	// ҳɹ
+		e = ht[pos];					// eԪֵ
+		return true;					// true
+	}
+	else
+	{	// ʧ
+		return false;					// false
+	}
+}
+
+#endif
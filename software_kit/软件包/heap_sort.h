@@ -2,18 +2,20 @@
 #define __HEAP_SORT_H__
 
 #include "utility.h"				// ʵó
-template <class ElemType>
-void SiftAdjust(ElemType elem[], int low, int high)
+#include "sort_compare.h"			// ȽϺ
+
+template <class ElemType, class Compare = LessCompare>
+void SiftAdjust(ElemType elem[], int low, int high, Compare comp = Compare())
 // :elem[low .. high]м¼elem[low]ⶼѶ,
-//	elem[low]ʹelem[low .. high]Ϊһ󶥶
+//	elem[low]ʹelem[low .. high]Ϊһ󶥶,СcompȽ
 {
 	for (int f = low, i = 2 * low + 1; i <= high; i = 2 * i + 1)
 	{	// fΪ,iΪf
-		if (i < high && elem[i] < elem[i + 1])
+		if (i < high && comp(elem[i], elem[i + 1]))
 		{	// ҺӸ, iָҺ
 			i++;
 		}
-		if (elem[f] >= elem[i])
+		if (!comp(elem[f], elem[i]))
 		{	// ѳΪ󶥶
 			break;
 		}
@@ -23,21 +25,21 @@ void SiftAdjust(ElemType elem[], int low, int high)
 }
 
 
-template <class ElemType>
-void HeapSort(ElemType elem[], int n)
-// :elemж
+template <class ElemType, class Compare = LessCompare>
+void HeapSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemж
 {
 	int i;
 	for (i = (n-2)/2; i >= 0; --i) 
 	{	// elem[0 .. n - 1]ɴ󶥶
-		SiftAdjust(elem, i, n - 1);
+		SiftAdjust(elem, i, n - 1, comp);
 	};
 
 	for (i = n - 1; i > 0; --i)
 	{	// i˶
 		Swap(elem[0], elem[i]);		
 			// ѶԪغ͵ǰδelem[0 .. i]һԪؽ
-		SiftAdjust(elem, 0, i - 1);	// elem[0 .. i - 1]µΪ󶥶
+		SiftAdjust(elem, 0, i - 1, comp);	// elem[0 .. i - 1]µΪ󶥶
 	}
 }
 
@@ -0,0 +1,273 @@
+#ifndef __INCREMENTAL_HASH_TABLE_H__
+#define __INCREMENTAL_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+
+// ۵״̬
+#define INC_SLOT_EMPTY 0							// ղ
+#define INC_SLOT_FULL 1								// ռò
+#define INC_SLOT_DELETED 2							// ɾ
+#define INC_MIGRATE_STEP 8							// ÿβǨƵĲ
+
+// ʽɢбģ: ʱ¾ɢб,ÿβֻǨINC_MIGRATE_STEP,
+//	Ǩǰͬʱ¾,ݲʹβͣ
+template <class ElemType, class KeyType>
+class IncrementalHashTable
+{
+protected:
+// ̽ɢбṹ
+	struct Table
+	{
+		ElemType *ht;								// ɢб
+		char *state;								// ۵״̬
+		int m;										// ɢб,Ϊ2
+		int count;									// Ԫظ
+		int deleted;								// ɾ۸
+	};
+
+//  ɢбݳԱ(ҲƽǨ,Ϊmutable):
+	mutable Table cur;								// ǰɢб,Ԫǲcur
+	mutable Table old;								// ǨƵľɢб,δǨʱold.mΪ0
+	mutable int migratePos;							// ɢбһǨƵĲ
+
+//	ģ:
+	static void InitTable(Table &t, int size);		// ʼΪsizeĿɢб
+	static void FreeTable(Table &t);				// ͷɢб
+	static int H(const KeyType &key, int m);		// ɢкģ
+	static bool SearchHelp(const Table &t, const KeyType &key, int &pos);
+		// ɢбtвѰؼΪkeyԪصλ
+	static void InsertHelp(Table &t, const ElemType &e);	// ȷ֪ڵԪeɢбt
+	void MigrateStep() const;						// ǨƾɢбINC_MIGRATE_STEP
+	void StartResize(int size);						// ʼΪsize
+
+public:
+//  ɢбرϵͳĬϷ:
+	IncrementalHashTable(int size = DEFAULT_SIZE);	// 캯ģ
+	~IncrementalHashTable();						// 캯ģ
+	int Length() const;								// Ԫظ
+	bool Resizing() const;							// жǷǨ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Insert(const ElemType &e);					// Ԫe
+	bool Delete(const KeyType &key);				// ɾؼΪkeyԪ
+
+private:
+	IncrementalHashTable(const IncrementalHashTable<ElemType, KeyType> &copy);	// ֹ
+	IncrementalHashTable<ElemType, KeyType> &operator=
+		(const IncrementalHashTable<ElemType, KeyType> &copy);	// ֵֹ
+};
+
+// ʽɢбģʵֲ
+template <class ElemType, class KeyType>
+void IncrementalHashTable<ElemType, KeyType>::InitTable(Table &t, int size)
+// : ʼΪsizeĿɢб,״̬calloc,ڴɲϵͳ
+//	ҳ,ʱ޹
+{
+	t.m = size;										// ɢб
+	t.count = 0;									// Ԫظ
+	t.deleted = 0;									// ɾ۸
+	t.ht = new ElemType[size];						// 洢ռ
+	t.state = (char *)calloc(size, sizeof(char));	// вΪINC_SLOT_EMPTY
+}
+
+template <class ElemType, class KeyType>
+void IncrementalHashTable<ElemType, KeyType>::FreeTable(Table &t)
+// : ͷɢбtĴ洢ռ
+{
+	delete []t.ht;									// ͷht
+	free(t.state);									// ͷstate
+	t.ht = NULL;
+	t.state = NULL;
+	t.m = t.count = t.deleted = 0;
+}
+
+template <class ElemType, class KeyType>
+int IncrementalHashTable<ElemType, KeyType>::H(const KeyType &key, int m)
+// : Ϊmɢбеɢеַ
+{
+	return (int)(HashMix((unsigned long long)key) & (m - 1));
+}
+
+template <class ElemType, class KeyType>
+bool IncrementalHashTable<ElemType, KeyType>::SearchHelp(const Table &t, const KeyType &key,
+	int &pos)
+// : ɢбtвѰؼΪkeyԪصλ,ҳɹ,true,pos
+//	ָʾԪصλ,򷵻false
+{
+	if (t.m == 0) return false;						// ձ
+	pos = H(key, t.m);								// ɢеַ
+	for (int c = 0; c < t.m && t.state[pos] != INC_SLOT_EMPTY; c++)
+	{	// ̽,ɾ۲ж̽
+		if (t.state[pos] == INC_SLOT_FULL && t.ht[pos] == key)
+		{	// ҳɹ
+			return true;
+		}
+		pos = (pos + 1) & (t.m - 1);				// һַ̽
+	}
+	return false;									// ʧ
+}
+
+template <class ElemType, class KeyType>
+void IncrementalHashTable<ElemType, KeyType>::InsertHelp(Table &t, const ElemType &e)
+// ʼ: ɢбtвԪeпղۻɾ
+// : Ԫeһղۻɾ
+{
+	int pos = H(e, t.m);							// ɢеַ
+	while (t.state[pos] == INC_SLOT_FULL)
+	{	// ̽
+		pos = (pos + 1) & (t.m - 1);
+	}
+	if (t.state[pos] == INC_SLOT_DELETED) t.deleted--;	// ɾ
+	t.ht[pos] = e;
+	t.state[pos] = INC_SLOT_FULL;
+	t.count++;
+}
+
+template <class ElemType, class KeyType>
+void IncrementalHashTable<ElemType, KeyType>::MigrateStep() const
+// : ɢбдmigratePosʼINC_MIGRATE_STEP۵Ԫ뵱ǰɢб,
+//	ɢбǨϺͷ֮
+{
+	if (old.m == 0) return;							// δǨ
+
+	for (int i = 0; i < INC_MIGRATE_STEP && migratePos < old.m; i++, migratePos++)
+	{	// Ǩһ
+		if (old.state[migratePos] == INC_SLOT_FULL)
+		{	// Ԫ뵱ǰɢб
+			InsertHelp(cur, old.ht[migratePos]);
+			old.state[migratePos] = INC_SLOT_DELETED;
+			old.count--;
+		}
+	}
+	if (migratePos >= old.m)
+	{	// Ǩ
+		FreeTable(old);
+	}
+}
+
+template <class ElemType, class KeyType>
+void IncrementalHashTable<ElemType, KeyType>::StartResize(int size)
+// ʼ: δǨ
+// : ǰɢбΪɢб,Ϊsizeɢб,ʼǨ
+{
+	old = cur;										// ǰɢбΪɢб
+	InitTable(cur, size);							// ɢб
+	migratePos = 0;
+}
+
+template <class ElemType, class KeyType>
+IncrementalHashTable<ElemType, KeyType>::IncrementalHashTable(int size)
+// : һٿsizeԪصĿɢб
+{
+	int capacity = 16;
+	while (capacity / 4 * 3 < size)
+	{	// ȡ2,װӲ3/4
+		capacity *= 2;
+	}
+	InitTable(cur, capacity);
+	old.ht = NULL;
+	old.state = NULL;
+	old.m = old.count = old.deleted = 0;
+	migratePos = 0;
+}
+
+template <class ElemType, class KeyType>
+IncrementalHashTable<ElemType, KeyType>::~IncrementalHashTable()
+// : ɢб
+{
+	FreeTable(cur);
+	FreeTable(old);
+}
+
+template <class ElemType, class KeyType>
+int IncrementalHashTable<ElemType, KeyType>::Length() const
+// : Ԫظ
+{
+	return cur.count + old.count;
+}
+
+template <class ElemType, class KeyType>
+bool IncrementalHashTable<ElemType, KeyType>::Resizing() const
+// : ǨƷtrue,򷵻false
+{
+	return old.m != 0;
+}
+
+template <class ElemType, class KeyType>
+void IncrementalHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζ¾ɢбÿԪصú(*visit)
+{
+	for (int pos = 0; pos < cur.m; pos++)
+	{	// ǰɢб
+		if (cur.state[pos] == INC_SLOT_FULL) (*visit)(cur.ht[pos]);
+	}
+	for (int pos = 0; pos < old.m; pos++)
+	{	// ɢбδǨƵԪ
+		if (old.state[pos] == INC_SLOT_FULL) (*visit)(old.ht[pos]);
+	}
+}
+
+template <class ElemType, class KeyType>
+bool IncrementalHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false.ǨδʱȲ鵱ǰɢб,ٲɢб
+{
+	MigrateStep();									// ƽǨ
+	int pos;										// Ԫصλ
+	if (SearchHelp(cur, key, pos))
+	{	// ڵǰɢбвҳɹ
+		e = cur.ht[pos];
+		return true;
+	}
+	if (SearchHelp(old, key, pos))
+	{	// ھɢбвҳɹ
+		e = old.ht[pos];
+		return true;
+	}
+	return false;									// ʧ
+}
+
+template <class ElemType, class KeyType>
+bool IncrementalHashTable<ElemType, KeyType>::Insert(const ElemType &e)
+// : ɢбвԪe,ɹtrue,ԪѴڷfalse.
+//	ռòɾ۳ǰ3/4ʱʼǨ
+{
+	MigrateStep();									// ƽǨ
+	int pos;										// Ԫλ
+	if (SearchHelp(cur, e, pos) || SearchHelp(old, e, pos))
+	{	// ԪѴ,ʧ
+		return false;
+	}
+
+	if (old.m == 0 && cur.count + cur.deleted + 1 > cur.m / 4 * 3)
+	{	// װ,Ԫؽ϶ʱӱ,ֻɾ
+		StartResize(cur.count + 1 > cur.m / 8 * 3 ? 2 * cur.m : cur.m);
+		MigrateStep();
+	}
+	InsertHelp(cur, e);								// 뵱ǰɢб
+	return true;
+}
+
+template <class ElemType, class KeyType>
+bool IncrementalHashTable<ElemType, KeyType>::Delete(const KeyType &key)
+// : ɾؼΪkeyԪ,ɾɹtrue,򷵻false
+{
+	MigrateStep();									// ƽǨ
+	int pos;										// Ԫλ
+	if (SearchHelp(cur, key, pos))
+	{	// ڵǰɢбɾ
+		cur.state[pos] = INC_SLOT_DELETED;
+		cur.count--;
+		cur.deleted++;
+		return true;
+	}
+	if (SearchHelp(old, key, pos))
+	{	// ھɢбɾ
+		old.state[pos] = INC_SLOT_DELETED;
+		old.count--;
+		return true;
+	}
+	return false;									// ɾʧ
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef __INTERPOLATION_SERACH_H__
+#define __INTERPOLATION_SERACH_H__
+
+#define INTERPOLATION_SQ_THRESHOLD 16	// 䲻˳ʱ˳
+
+template <class ElemType, class KeyType>
+int InterpolationSerach(ElemType elem[], int n, KeyType key)
+// ʼ: elem[0 .. n - 1],ؼֿתΪdouble
+// : вؼֵֵkeyļ¼,ҳɹ,򷵻ش˼¼,
+//	-1.key˹ؼ֮ıλ,ؼֲַʱ̽ԼΪ
+//	O(log log n);һβֵδʹ,۰һ,ΪO(log n).
+//	϶ʱ˳
+{
+	int low = 0, high = n - 1;			// ֵ
+
+	while (high - low > INTERPOLATION_SQ_THRESHOLD)
+	{
+		if (key < elem[low] || elem[high] < key)
+		{	// key֮
+			return -1;
+		}
+		double lowKey = (double)elem[low], highKey = (double)elem[high];
+		if (highKey <= lowKey)
+		{	// ڹؼȫ
+			break;
+		}
+		int width = high - low;			// ֵǰ䳤
+		int pos = low + (int)(((double)key - lowKey) / (highKey - lowKey) * width);
+		if (pos < low) pos = low;
+		else if (pos > high) pos = high;
+
+		if (key == elem[pos])
+		{	// ҳɹ
+			return pos;
+		}
+		else if (key < elem[pos])
+		{	// 
+			high = pos - 1;
+		}
+		else
+		{	// Ҳ
+			low = pos + 1;
+		}
+
+		if (high - low > width / 2)
+		{	// ֵƫϴ,۰һԱ֤ټ
+			int mid = (low + high) / 2;	// мλ
+			if (key == elem[mid])
+			{	// ҳɹ
+				return mid;
+			}
+			else if (key < elem[mid])
+			{	// в
+				high = mid - 1;
+			}
+			else
+			{	// Ұв
+				low = mid + 1;
+			}
+		}
+	}
+
+	for (; low <= high && elem[low] < key; low++);	// ˳
+	if (low <= high && key == elem[low])
+	{	// ҳɹ
+		return low;
+	}
+	return -1;							// ʧ
+}
+
+#endif
@@ -0,0 +1,312 @@
+#ifndef __LOSER_TREE_H__
+#define __LOSER_TREE_H__
+
+#include "utility.h"							// ʵó
+#include "lk_list.h"							// 
+
+// 鲢Դ: ǵݼṩԪ,ʱReadfalse.ֱʹκξ
+//	bool Read(ElemType &e)ΪԴ,еRecordReader;ͬԴ
+//	鲢ʱʹĳ
+template <class ElemType>
+class MergeSource
+{
+public:
+	virtual ~MergeSource() {}					// ģ
+	virtual bool Read(ElemType &e) = 0;			// һԪ
+};
+
+// Դģ
+template <class ElemType>
+class ArrayMergeSource: public MergeSource<ElemType>
+{
+protected:
+//  ԴݳԱ:
+	const ElemType *elem;						// 
+	int n;										// Ԫظ
+	int pos;									// һԪصλ
+
+public:
+//  :
+	ArrayMergeSource(const ElemType e[] = NULL, int cnt = 0);	// e[0 .. cnt - 1]
+	bool Read(ElemType &e);						// һԪ
+};
+
+// Դģ
+template <class ElemType>
+class LinkListMergeSource: public MergeSource<ElemType>
+{
+protected:
+//  ԴݳԱ:
+	const LinkList<ElemType> *list;				// 
+	int pos;									// һԪص
+
+public:
+//  :
+	LinkListMergeSource(const LinkList<ElemType> *la = NULL);	// 
+	bool Read(ElemType &e);						// һԪ
+};
+
+// Դģ: ReadĶ(RecordReader)װΪԴ
+template <class ElemType, class ReaderType>
+class ReaderMergeSource: public MergeSource<ElemType>
+{
+protected:
+//  ԴݳԱ:
+	ReaderType *reader;							// 
+
+public:
+//  :
+	ReaderMergeSource(ReaderType *r = NULL);	// ɶ
+	bool Read(ElemType &e);						// һԪ
+};
+
+// ģ: kԴΪҶ,ڲ¼İ,tree[0]¼ھ.ȡ߹ھֻ
+//	Ҷ·߱Ƚ,ÿԪرȽԼlog k.ԪʱСԴ
+//	ʤ,ʹ鲢ȶ
+template <class ElemType, class SourceType = MergeSource<ElemType> >
+class LoserTree
+{
+protected:
+//  ݳԱ:
+	SourceType **source;						// Դ
+	int k;										// Դĸ
+	ElemType *key;								// ԴĵǰԪ
+	bool *active;								// ԴǷԪ
+	int *tree;									// tree[1 .. k - 1]Ϊ, tree[0]Ϊھ
+
+//	ģ:
+	bool Beats(int a, int b) const;				// ԴaĵǰԪǷʤԴb
+	int Build(int node);						// ԵϽnodeΪı,ʤ
+	void Replay(int s);							// ԴsĵǰԪظº
+
+public:
+//  : ʹ鲢
+	class Iterator
+	{
+	protected:
+		LoserTree *owner;						// , NULLʾ
+	public:
+		Iterator(LoserTree *t): owner(t) { if (owner != NULL && owner->Empty()) owner = NULL; }
+		const ElemType &operator *() const { return owner->Top(); }	// ǰԪ
+		Iterator &operator ++() { ElemType e; owner->Read(e); if (owner->Empty()) owner = NULL; return *this; }
+		bool operator !=(const Iterator &other) const { return owner != other.owner; }
+	};
+
+//  :
+	LoserTree(SourceType *src[], int cnt);		// Դsrc[0 .. cnt - 1]
+	~LoserTree();								// ģ
+	bool Empty() const;							// жǷѹ鲢
+	const ElemType &Top() const;				// صǰСԪ
+	int TopSource() const;						// صǰСԪڵԴ
+	bool Read(ElemType &e);						// ȡǰСԪ
+	Iterator begin();							// ʼ
+	Iterator end();								// 
+
+private:
+	LoserTree(const LoserTree<ElemType, SourceType> &copy);	// ֹ
+	LoserTree<ElemType, SourceType> &operator =(const LoserTree<ElemType, SourceType> &copy);
+		// ֵֹ
+};
+
+// ·鲢ģ
+template <class ElemType>
+int MultiwayMerge(const ElemType *elem[], const int len[], int k, ElemType out[]);
+	// elem[i][0 .. len[i] - 1](0 <= i < k)һ˹鲢out
+
+// Դģʵֲ
+template <class ElemType>
+ArrayMergeSource<ElemType>::ArrayMergeSource(const ElemType e[], int cnt)
+// : e[0 .. cnt - 1]Դ
+{
+	elem = e;
+	n = cnt;
+	pos = 0;
+}
+
+template <class ElemType>
+bool ArrayMergeSource<ElemType>::Read(ElemType &e)
+// : eһԪ,Ѷʱfalse
+{
+	if (pos >= n) return false;
+	e = elem[pos++];
+	return true;
+}
+
+template <class ElemType>
+LinkListMergeSource<ElemType>::LinkListMergeSource(const LinkList<ElemType> *la)
+// : laԴ
+{
+	list = la;
+	pos = 1;
+}
+
+template <class ElemType>
+bool LinkListMergeSource<ElemType>::Read(ElemType &e)
+// : eһԪ,Ѷʱfalse.¼ǰλ,˳ȡʱ
+//	ÿֻһ
+{
+	return list != NULL && list->GetElem(pos++, e) == ENTRY_FOUND;
+}
+
+template <class ElemType, class ReaderType>
+ReaderMergeSource<ElemType, ReaderType>::ReaderMergeSource(ReaderType *r)
+// : ɶrԴ
+{
+	reader = r;
+}
+
+template <class ElemType, class ReaderType>
+bool ReaderMergeSource<ElemType, ReaderType>::Read(ElemType &e)
+// : eضһԪ,Ѷʱfalse
+{
+	return reader != NULL && reader->Read(e);
+}
+
+// ģʵֲ
+template <class ElemType, class SourceType>
+bool LoserTree<ElemType, SourceType>::Beats(int a, int b) const
+// : ԴaĵǰԪСԴbĵǰԪ,a < bʱtrue;ѶԴ
+//	Ϊ
+{
+	if (active[a] != active[b]) return active[a];
+	if (active[a])
+	{	// Ԫ
+		if (key[a] < key[b]) return true;
+		if (key[b] < key[a]) return false;
+	}
+	return a < b;
+}
+
+template <class ElemType, class SourceType>
+int LoserTree<ElemType, SourceType>::Build(int node)
+// : 1 .. k - 1Ϊڲ,k .. 2k - 1ΪҶ,nodeΪĸ
+//	,߼ڲ,ʤ
+{
+	if (node >= k) return node - k;				// Ҷ
+	int left = Build(2 * node), right = Build(2 * node + 1);
+	if (Beats(left, right))
+	{	// ʤ
+		tree[node] = right;
+		return left;
+	}
+	else
+	{	// ʤ
+		tree[node] = left;
+		return right;
+	}
+}
+
+template <class ElemType, class SourceType>
+void LoserTree<ElemType, SourceType>::Replay(int s)
+// : ԴsĵǰԪظº,Ҷ㵽·
+{
+	int winner = s;
+	for (int node = (s + k) / 2; node > 0; node /= 2)
+	{	// node¼İ߱
+		if (Beats(tree[node], winner)) Swap(tree[node], winner);
+	}
+	tree[0] = winner;
+}
+
+template <class ElemType, class SourceType>
+LoserTree<ElemType, SourceType>::LoserTree(SourceType *src[], int cnt)
+// : ӸԴԪ,
+{
+	k = cnt;
+	source = new SourceType *[k > 0 ? k : 1];
+	key = new ElemType[k > 0 ? k : 1];
+	active = new bool[k > 0 ? k : 1];
+	tree = new int[k > 0 ? k : 1];
+	for (int i = 0; i < k; i++)
+	{	// iԴԪ
+		source[i] = src[i];
+		active[i] = source[i]->Read(key[i]);
+	}
+	tree[0] = k > 0 ? Build(1) : 0;
+}
+
+template <class ElemType, class SourceType>
+LoserTree<ElemType, SourceType>::~LoserTree()
+// : ͷŰռռ,Դɵ߹
+{
+	delete []source;
+	delete []key;
+	delete []active;
+	delete []tree;
+}
+
+template <class ElemType, class SourceType>
+bool LoserTree<ElemType, SourceType>::Empty() const
+// : ԴѶʱtrue,򷵻false
+{
+	return k == 0 || !active[tree[0]];
+}
+
+template <class ElemType, class SourceType>
+const ElemType &LoserTree<ElemType, SourceType>::Top() const
+// ʼ: ǿ
+// : صǰСԪ
+{
+	return key[tree[0]];
+}
+
+template <class ElemType, class SourceType>
+int LoserTree<ElemType, SourceType>::TopSource() const
+// ʼ: ǿ
+// : صǰСԪԴ
+{
+	return tree[0];
+}
+
+template <class ElemType, class SourceType>
+bool LoserTree<ElemType, SourceType>::Read(ElemType &e)
+// : eصǰСԪ,ԴһԪغ;ѹ鲢ʱ
+//	false.ҲΪһԴ
+{
+	if (Empty()) return false;
+	int s = tree[0];							// ھڵԴ
+	e = key[s];
+	active[s] = source[s]->Read(key[s]);
+	Replay(s);
+	return true;
+}
+
+template <class ElemType, class SourceType>
+typename LoserTree<ElemType, SourceType>::Iterator LoserTree<ElemType, SourceType>::begin()
+// : ָǰСԪصĵ
+{
+	return Iterator(this);
+}
+
+template <class ElemType, class SourceType>
+typename LoserTree<ElemType, SourceType>::Iterator LoserTree<ElemType, SourceType>::end()
+// : رʾ鲢ĵ
+{
+	return Iterator(NULL);
+}
+
+// ·鲢ģʵֲ
+template <class ElemType>
+int MultiwayMerge(const ElemType *elem[], const int len[], int k, ElemType out[])
+// : kelem[i][0 .. len[i] - 1]ðһ˹鲢out,
+//	Ԫظ
+{
+	ArrayMergeSource<ElemType> *src = new ArrayMergeSource<ElemType>[k > 0 ? k : 1];
+	ArrayMergeSource<ElemType> **ptr = new ArrayMergeSource<ElemType> *[k > 0 ? k : 1];
+	for (int i = 0; i < k; i++)
+	{	// i
+		src[i] = ArrayMergeSource<ElemType>(elem[i], len[i]);
+		ptr[i] = &src[i];
+	}
+
+	int n = 0;
+	{	// ȡСԪ
+		LoserTree<ElemType, ArrayMergeSource<ElemType> > tree(ptr, k);
+		while (tree.Read(out[n])) n++;
+	}
+	delete []ptr;
+	delete []src;
+	return n;
+}
+
+#endif
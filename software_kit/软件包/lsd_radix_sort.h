@@ -0,0 +1,145 @@
+#ifndef __LSD_RADIX_SORT_H__
+#define __LSD_RADIX_SORT_H__
+
+#include "utility.h"			// ʵó
+
+// λȻ: ؼӳΪ޷,ֽڴӵ͵ȶ.ֽڵļ
+//	һɨͬʱ,ʱɼǰ׺ֱԪصλ,elemһʱ
+//	֮佻.Ԫĳֽڶͬʱ
+
+// ӳ: ؼӳΪ޷,ʹ޷ĴСԭͬ
+inline unsigned int RadixOrderedKey(unsigned int key)
+// : ޷
+{
+	return key;
+}
+
+inline unsigned int RadixOrderedKey(int key)
+// : תλ,ڷǸ֮ǰ
+{
+	return (unsigned int)key ^ 0x80000000u;
+}
+
+inline unsigned int RadixOrderedKey(unsigned short key)
+// : ޷Ŷ
+{
+	return key;
+}
+
+inline unsigned int RadixOrderedKey(short key)
+// : ӳΪ0ʼ޷
+{
+	return (unsigned int)(key + 32768);
+}
+
+inline unsigned long long RadixOrderedKey(unsigned long long key)
+// : ޷
+{
+	return key;
+}
+
+inline unsigned long long RadixOrderedKey(long long key)
+// : תλ
+{
+	return (unsigned long long)key ^ 0x8000000000000000ULL;
+}
+
+inline unsigned long long RadixOrderedKey(unsigned long key)
+// : ޷, longΪ32λʱֽȫΪ0,ʱ
+{
+	return key;
+}
+
+inline unsigned long long RadixOrderedKey(long key)
+// : 64λתλ
+{
+	return RadixOrderedKey((long long)key);
+}
+
+inline unsigned int RadixOrderedKey(float key)
+// : תȫλ,Ǹתλ,ʹIEEE 754λģʽ޷Ƚʱ
+//	ͬ
+{
+	unsigned int bits;
+	memcpy(&bits, &key, sizeof(bits));
+	return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+
+inline unsigned long long RadixOrderedKey(double key)
+// : תȫλ,Ǹתλ
+{
+	unsigned long long bits;
+	memcpy(&bits, &key, sizeof(bits));
+	return (bits & 0x8000000000000000ULL) ? ~bits : bits | 0x8000000000000000ULL;
+}
+
+// ĬϹؼֺ: ԪرΪؼ
+struct RadixDefaultKey
+{
+	template <class ElemType>
+	auto operator()(const ElemType &e) const -> decltype(RadixOrderedKey(e))
+	// : eıӳ
+	{
+		return RadixOrderedKey(e);
+	}
+};
+
+template <class ElemType, class KeyFunc>
+void LsdRadixSort(ElemType elem[], int n, KeyFunc key)
+// ʼ: key(e)Ԫe޷ؼ,Լ¼ĳԱRadixOrderedKey
+// : key(e)elemȶλȻ
+{
+	typedef decltype(key(elem[0])) KeyType;	// ޷ؼ
+	const int bytes = sizeof(KeyType);		// ؼֽ,
+	if (n < 2) return;
+
+	int count[sizeof(KeyType)][256];		// ֽȡֵԪظ
+	memset(count, 0, sizeof(count));
+	for (int i = 0; i < n; i++)
+	{	// һɨֽڵļ
+		KeyType k = key(elem[i]);
+		for (int b = 0; b < bytes; b++)
+		{	// bֽ
+			count[b][(k >> (8 * b)) & 0xFF]++;
+		}
+	}
+
+	ElemType *tmpElem = new ElemType[n];	// ʱ
+	ElemType *src = elem, *dst = tmpElem;	// ˵ԴĿ
+	for (int b = 0; b < bytes; b++)
+	{	// bֽڷ
+		int firstByte = (int)((key(elem[0]) >> (8 * b)) & 0xFF);
+		if (count[b][firstByte] == n)
+		{	// Ԫظֽͬ,
+			continue;
+		}
+
+		int pos[256];						// ֵһλ
+		for (int v = 0, sum = 0; v < 256; v++)
+		{	// ǰ׺
+			pos[v] = sum;
+			sum += count[b][v];
+		}
+		for (int i = 0; i < n; i++)
+		{	// ȶ
+			dst[pos[(key(src[i]) >> (8 * b)) & 0xFF]++] = src[i];
+		}
+		Swap(src, dst);
+	}
+
+	if (src != elem)
+	{	// tmpElem,ƻelem
+		for (int i = 0; i < n; i++) elem[i] = src[i];
+	}
+	delete []tmpElem;						// ͷtmpElemռÿռ
+}
+
+template <class ElemType>
+void LsdRadixSort(ElemType elem[], int n)
+// ʼ: ElemTypeΪͻ򸡵
+// : elemλȻ
+{
+	LsdRadixSort(elem, n, RadixDefaultKey());
+}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include "utility.h"						// ʵó
+
+#ifdef _WIN32
+#include <windows.h>						// ļӳ
+#else
+#include <fcntl.h>							// open
+#include <unistd.h>							// close
+#include <sys/mman.h>						// mmap
+#include <sys/stat.h>						// fstat
+#endif
+
+// ֻڴӳļ: ļݰҳ״ηʱ,Ҫڴ
+class MappedFile
+{
+protected:
+//  ڴӳļݳԱ:
+	char *data;								// ӳʼַ
+	long long size;							// ļ
+#ifdef _WIN32
+	HANDLE file;							// ļ
+	HANDLE mapping;							// ӳ
+#else
+	int fd;									// ļ
+#endif
+
+public:
+//  :
+	MappedFile();							// 캯
+	~MappedFile();							// 
+	bool Open(const char *fileName);		// ֻʽӳļ
+	void Close();							// ӳ䲢رļ
+	const char *Data() const;				// ӳʼַ
+	long long Size() const;					// ļ
+
+private:
+	MappedFile(const MappedFile &copy);		// ֹ
+	MappedFile &operator =(const MappedFile &copy);	// ֵֹ
+};
+
+// ڴӳļʵֲ
+inline MappedFile::MappedFile()
+// : δӳκļĶ
+{
+	data = NULL;
+	size = 0;
+#ifdef _WIN32
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+#else
+	fd = -1;
+#endif
+}
+
+inline MappedFile::~MappedFile()
+// : ӳ
+{
+	Close();
+}
+
+inline bool MappedFile::Open(const char *fileName)
+// : ֻʽӳļfileName,ɹtrue,򷵻false
+{
+	Close();								// ԭӳ
+#ifdef _WIN32
+	file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return false;
+	LARGE_INTEGER len;
+	if (!GetFileSizeEx(file, &len) || len.QuadPart == 0)
+	{	// ޷ȡļȻļ
+		Close();
+		return false;
+	}
+	size = len.QuadPart;
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL)
+	{	// ӳʧ
+		Close();
+		return false;
+	}
+	data = (char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	fd = open(fileName, O_RDONLY);
+	if (fd < 0) return false;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0)
+	{	// ޷ȡļȻļ
+		Close();
+		return false;
+	}
+	size = st.st_size;
+	void *addr = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fd, 0);
+	data = addr == MAP_FAILED ? NULL : (char *)addr;
+#endif
+	if (data == NULL)
+	{	// ӳʧ
+		Close();
+		return false;
+	}
+	return true;
+}
+
+inline void MappedFile::Close()
+// : ӳ䲢رļ
+{
+#ifdef _WIN32
+	if (data != NULL) UnmapViewOfFile(data);
+	if (mapping != NULL) CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+	mapping = NULL;
+	file = INVALID_HANDLE_VALUE;
+#else
+	if (data != NULL) munmap(data, (size_t)size);
+	if (fd >= 0) close(fd);
+	fd = -1;
+#endif
+	data = NULL;
+	size = 0;
+}
+
+inline const char *MappedFile::Data() const
+// : ӳʼַ
+{
+	return data;
+}
+
+inline long long MappedFile::Size() const
+// : ļ
+{
+	return size;
+}
+
+#endif
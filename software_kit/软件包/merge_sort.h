@@ -1,8 +1,16 @@
 #ifndef __MERGE_SORT_H__
 #define __MERGE_SORT_H__
 
-template <class ElemType>
-void Merge(ElemType elem[], ElemType tmpElem[], int low, int mid, int high)
+#include "utility.h"						// ʵó
+#include "sort_compare.h"					// ȽϺ
+#include "sorting_network.h"				// 
+
+#define MERGE_SORT_RUN 32					// ԵϹ鲢ֱӲĶγ
+#define MERGE_SORT_CACHE_BYTES 262144		// ڴֽĿɹ鲢,ʹڻ
+
+template <class ElemType, class Compare = LessCompare>
+void Merge(ElemType elem[], ElemType tmpElem[], int low, int mid, int high,
+	Compare comp = Compare())
 // :elem[low .. mid]elem[mid + 1 .. midhigh]鲢Ϊµ
 //	elem[low .. high]
 {
@@ -11,7 +19,7 @@ void Merge(ElemType elem[], ElemType tmpElem[], int low, int mid, int high)
 	for (i = low, j = mid + 1, k = low; i <= mid && j <= high; k++)
 	{	// iΪ鲢ʱelem[low .. mid]ǰԪص±,jΪ鲢ʱelem[mid + 1 .. high]ǰԪ
 		// ±,kΪtmpElemеǰԪص±
-		if (elem[i] <= elem[j])
+		if (!comp(elem[j], elem[i]))
 		{	// elem[i]С,ȹ鲢
 			tmpElem[k] = elem[i];
 			i++;
@@ -39,28 +47,123 @@ void Merge(ElemType elem[], ElemType tmpElem[], int low, int mid, int high)
 	}
 }
 
-template <class ElemType>
-void MergeSortHelp(ElemType elem[], ElemType tmpElem[], int low, int high)
-// :elem[low .. high]й鲢
+template <class ElemType, class Compare = LessCompare>
+void MergeSortHelp(ElemType elem[], ElemType tmpElem[], int low, int high,
+	Compare comp = Compare())
+// :elem[low .. high]й鲢,
 {
-	if (low < high)
+	if (high - low + 1 <= NETWORK_SORT_THRESHOLD)
+	{	// 
+		if (low < high) NetworkSort(elem + low, high - low + 1, comp);
+	}
+	else
 	{	
 		int mid = (low + high) / 2;			
 			// elem[low .. high]ƽΪelem[low .. mid]elem[mid + 1 .. high]
-		MergeSortHelp(elem, tmpElem, low, mid);		// elem[low .. mid]й鲢
-		MergeSortHelp(elem, tmpElem, mid + 1, high);// elem[mid + 1 .. high]й鲢
-		Merge(elem, tmpElem, low, mid, high);		// elem[low .. mid]elem[mid + 1 .. high]й鲢
+		MergeSortHelp(elem, tmpElem, low, mid, comp);	// elem[low .. mid]й鲢
+		MergeSortHelp(elem, tmpElem, mid + 1, high, comp);	// elem[mid + 1 .. high]й鲢
+		Merge(elem, tmpElem, low, mid, high, comp);	// elem[low .. mid]elem[mid + 1 .. high]й鲢
 	}
 }
 
-template <class ElemType>
-void MergeSort(ElemType elem[], int n)
-// :elemй鲢
+template <class ElemType, class Compare = LessCompare>
+void MergeSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemй鲢
 {
 	ElemType *tmpElem = new ElemType[n]; // ʱ
-	MergeSortHelp(elem, tmpElem, 0, n - 1);
+	MergeSortHelp(elem, tmpElem, 0, n - 1, comp);
 	delete []tmpElem;					// ͷtmpElemÿռ
 }
 
+template <class ElemType, class Compare = LessCompare>
+void BranchlessMerge(const ElemType src[], ElemType dst[], int low, int mid, int high,
+	Compare comp = Compare())
+// :src[low .. mid - 1]src[mid .. high - 1]鲢dst[low .. high - 1].
+//	ÿαȽϵĽֱѡȡԪغƶ±,Ԥķ֧
+{
+	int i = low, j = mid, k = low;
+	while (i < mid && j < high)
+	{	// ҶԪؽСʱȡҶ,ȡ,ȶ
+		bool takeRight = comp(src[j], src[i]);
+		dst[k++] = takeRight ? src[j] : src[i];
+		j += takeRight;
+		i += !takeRight;
+	}
+	while (i < mid) dst[k++] = src[i++];	// 鲢ʣԪ
+	while (j < high) dst[k++] = src[j++];	// 鲢ҶʣԪ
+}
+
+template <class ElemType, class Compare = LessCompare>
+long long MergePass(const ElemType src[], ElemType dst[], int low, int high, int width,
+	Compare comp = Compare())
+// :src[low .. high - 1]гΪwidth鲢dst,ƶ
+//	Ԫظ
+{
+	for (int start = low; start < high; start += 2 * width)
+	{	// 鲢src[start .. start + 2 * width - 1]
+		int mid = high - start > width ? start + width : high;
+		int end = high - mid > width ? mid + width : high;
+		BranchlessMerge(src, dst, start, mid, end, comp);
+	}
+	return high - low;
+}
+
+template <class ElemType, class Compare = LessCompare>
+long long BottomUpMergeSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemԵϵĹ鲢,ƶֽ.ȶԳΪ
+//	MERGE_SORT_RUNĶֱӲ,MERGE_SORT_CACHE_BYTESСĿɸ˹鲢,
+//	˹鲢.elemһnԪصʱ֮佻,ƻ
+{
+	if (n < 2) return 0;
+	long long moved = 0;					// ƶԪظ
+	ElemType *tmpElem = new ElemType[n];	// Ψһʱ
+
+	for (int low = 0; low < n; low += MERGE_SORT_RUN)
+	{	// elem[low .. low + MERGE_SORT_RUN - 1]ֱӲ
+		int high = n - low > MERGE_SORT_RUN ? low + MERGE_SORT_RUN : n;
+		for (int i = low + 1; i < high; i++)
+		{	// elem[i]
+			ElemType e = elem[i];
+			int j;
+			for (j = i - 1; j >= low && comp(e, elem[j]); j--)
+			{	// eļ¼
+				elem[j + 1] = elem[j];
+			}
+			elem[j + 1] = e;
+			moved += i - j + 1;
+		}
+	}
+
+	int block = MERGE_SORT_RUN;				// Ԫظ,Ϊγ2ݱ
+	while ((long long)block * 2 * sizeof(ElemType) <= MERGE_SORT_CACHE_BYTES) block *= 2;
+	ElemType *src = elem, *dst = tmpElem;	// ˵ԴĿ
+	int passes = 0;							// ڹ鲢,ͬ
+	for (int width = MERGE_SORT_RUN; width < block; width *= 2) passes++;
+	for (int low = 0; low < n; low += block)
+	{	// ڿelem[low .. low + block - 1]ɸ˹鲢
+		int high = n - low > block ? low + block : n;
+		ElemType *from = elem, *to = tmpElem;
+		for (int width = MERGE_SORT_RUN; width < block; width *= 2)
+		{	// һ˹鲢
+			moved += MergePass(from, to, low, high, width, comp);
+			Swap(from, to);
+		}
+	}
+	if (passes % 2 != 0) Swap(src, dst);	// ˺tmpElem
+
+	for (int width = block; width < n; width = width > n / 2 ? n : 2 * width)
+	{	// ˹鲢
+		moved += MergePass(src, dst, 0, n, width, comp);
+		Swap(src, dst);
+	}
+	if (src != elem)
+	{	// tmpElem,ƻelem
+		for (int i = 0; i < n; i++) elem[i] = src[i];
+		moved += n;
+	}
+	delete []tmpElem;						// ͷtmpElemռÿռ
+	return moved * (long long)sizeof(ElemType);
+}
+
 #endif
 
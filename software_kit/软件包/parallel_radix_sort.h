@@ -0,0 +1,345 @@
+#ifndef __PARALLEL_RADIX_SORT_H__
+#define __PARALLEL_RADIX_SORT_H__
+
+#include "utility.h"				// ʵó
+#include "string.h"					// 
+#include "thread_pool.h"			// ̳߳
+#include "lsd_radix_sort.h"			// ӳRadixOrderedKey
+#include "parallel_sort.h"			// PARALLEL_SORT_GRAIN
+
+#define MSD_RADIX_THRESHOLD 64		// ͰԪز˸ʱֱӲ
+
+// λȻ(): ǰֽڼͰ,ٷʹÿ
+//	ԪͰ.зֶɸ߳ͬʱ,߳ʹԼļ,ɸε
+//	ÿ߳ÿͰедλ,̰߳ѱԪط䵽һʱ,
+//	ƻ,ʱĵһ˷Ҳǲе,nԪصʱ.϶̵ɱ߳
+//	ѭ͵ط,Ҫʱ.ϴͰΪ,СͰɱ̵߳ݹ
+
+template <class ElemType, class KeyFunc>
+void MsdInsertSort(ElemType elem[], int n, KeyFunc key)
+// :key(e)elem[0 .. n - 1]ֱӲ
+{
+	for (int i = 1; i < n; i++)
+	{	// iֱӲ
+		ElemType e = elem[i];
+		auto k = key(e);
+		int j;
+		for (j = i - 1; j >= 0 && k < key(elem[j]); j--)
+		{	// ؼֱkļ¼
+			elem[j + 1] = elem[j];
+		}
+		elem[j + 1] = e;
+	}
+}
+
+inline int MsdParts(ThreadPool &pool, int n)
+// :nԪطָ̼߳Ķ,ÿPARALLEL_SORT_GRAINԪ
+{
+	int parts = pool.ThreadCount();			// ֶ
+	if (parts > n / PARALLEL_SORT_GRAIN) parts = n / PARALLEL_SORT_GRAIN;
+	return parts > 1 ? parts : 1;
+}
+
+template <class ElemType, class KeyFunc>
+void MsdCount(ThreadPool &pool, const ElemType elem[], int n, KeyFunc key, int shift,
+	int count[256], vector<int> &local)
+// :elem[0 .. n - 1]йؼֵshift / 8ֽȡֵԪظ.
+//	MsdParts(pool, n)1ʱֶɸ̼߳Եļ,ۼ,εļlocal
+//	, local[t * 256 + v]ΪtиֽΪvԪظ
+{
+	memset(count, 0, 256 * sizeof(int));
+	int parts = MsdParts(pool, n);			// ֶ
+	if (parts <= 1)
+	{	// ̼߳
+		for (int i = 0; i < n; i++) count[(key(elem[i]) >> shift) & 0xFF]++;
+		return;
+	}
+
+	local.assign(parts * 256, 0);			// ̵߳ļ
+	{	// βм
+		TaskGroup group(pool);
+		for (int t = 0; t < parts; t++)
+		{	// t
+			int *c = &local[t * 256];
+			int low = (int)((long long)n * t / parts), high = (int)((long long)n * (t + 1) / parts);
+			group.Run([elem, key, shift, c, low, high]()
+			{	// elem[low .. high - 1]
+				for (int i = low; i < high; i++) c[(key(elem[i]) >> shift) & 0xFF]++;
+			});
+		}
+		group.Wait();
+	}
+	for (int t = 0; t < parts; t++)
+	{	// ۼ
+		for (int v = 0; v < 256; v++) count[v] += local[t * 256 + v];
+	}
+}
+
+template <class ElemType, class KeyFunc>
+void MsdParallelScatter(ThreadPool &pool, ElemType elem[], int n, KeyFunc key, int shift,
+	vector<int> &local)
+// ʼ:localΪMsdCountĸμ,ΪMsdParts(pool, n)
+// :ؼֵshift / 8ֽڽelem[0 .. n - 1]䵽Ͱ.ɸμÿ
+//	ÿͰеʼλ,߳̽Ԫдʱ,ٲиƻelem
+{
+	int parts = MsdParts(pool, n);			// ֶ
+	for (int v = 0, sum = 0; v < 256; v++)
+	{	// Ͱvȷŵ0εԪ,ٷŵ1εԪ,...
+		for (int t = 0; t < parts; t++)
+		{	// tͰvеʼλ
+			int c = local[t * 256 + v];
+			local[t * 256 + v] = sum;
+			sum += c;
+		}
+	}
+
+	ElemType *tmpElem = new ElemType[n];	// ʱ
+	{	// βз
+		TaskGroup group(pool);
+		for (int t = 0; t < parts; t++)
+		{	// t
+			int *pos = &local[t * 256];
+			int low = (int)((long long)n * t / parts), high = (int)((long long)n * (t + 1) / parts);
+			group.Run([elem, tmpElem, key, shift, pos, low, high]()
+			{	// elem[low .. high - 1]
+				for (int i = low; i < high; i++) tmpElem[pos[(key(elem[i]) >> shift) & 0xFF]++] = elem[i];
+			});
+		}
+		group.Wait();
+	}
+	{	// иƻelem
+		TaskGroup group(pool);
+		for (int t = 0; t < parts; t++)
+		{	// t
+			int low = (int)((long long)n * t / parts), high = (int)((long long)n * (t + 1) / parts);
+			group.Run([elem, tmpElem, low, high]()
+			{	// tmpElem[low .. high - 1]
+				for (int i = low; i < high; i++) elem[i] = tmpElem[i];
+			});
+		}
+		group.Wait();
+	}
+	delete []tmpElem;						// ͷtmpElemռÿռ
+}
+
+template <class ElemType, class KeyFunc>
+void ParallelMsdRadixSortHelp(ThreadPool &pool, TaskGroup &group, ElemType elem[], int n,
+	KeyFunc key, int byte)
+// :ؼֵĵbyte͵ֽڶelem[0 .. n - 1]
+{
+	int count[256];							// ͰԪظ
+	vector<int> local;						// εļ
+	while (true)
+	{	// Ԫضֽͬ
+		if (n <= MSD_RADIX_THRESHOLD)
+		{	// ֱӲ
+			MsdInsertSort(elem, n, key);
+			return;
+		}
+		MsdCount(pool, elem, n, key, 8 * byte, count, local);
+		if (count[(key(elem[0]) >> (8 * byte)) & 0xFF] != n) break;
+		if (byte-- == 0) return;			// ؼȫͬ
+	}
+
+	int head[256], tail[256];				// ͰһλͰβ
+	for (int v = 0, sum = 0; v < 256; v++)
+	{	// ǰ׺Ͱ
+		head[v] = sum;
+		sum += count[v];
+		tail[v] = sum;
+	}
+	const int shift = 8 * byte;
+	if (MsdParts(pool, n) > 1)
+	{	// ̲߳з
+		MsdParallelScatter(pool, elem, n, key, shift, local);
+	}
+	else
+	{	// ߳ѭ͵ط
+		for (int v = 0; v < 256; v++)
+		{	// õvͰ
+			while (head[v] < tail[v])
+			{	// ȡelem[head[v]],ؽŵͰ,ֱͰvԪ
+				ElemType e = elem[head[v]];
+				int d = (int)((key(e) >> shift) & 0xFF);
+				while (d != v)
+				{	// eͰd,ԭԪ
+					Swap(e, elem[head[d]++]);
+					d = (int)((key(e) >> shift) & 0xFF);
+				}
+				elem[head[v]++] = e;
+			}
+		}
+	}
+	if (byte == 0) return;
+
+	for (int v = 0, low = 0; v < 256; low += count[v], v++)
+	{	// һֽͰ
+		if (count[v] <= 1) continue;
+		ElemType *bucket = elem + low;
+		int size = count[v];
+		if (size > PARALLEL_SORT_GRAIN)
+		{	// ͰΪ
+			group.Run([&pool, &group, bucket, size, key, byte]()
+			{	// һͰ
+				ParallelMsdRadixSortHelp(pool, group, bucket, size, key, byte - 1);
+			});
+		}
+		else
+		{	// СͰɱ߳
+			ParallelMsdRadixSortHelp(pool, group, bucket, size, key, byte - 1);
+		}
+	}
+}
+
+template <class ElemType, class KeyFunc>
+void ParallelMsdRadixSort(ElemType elem[], int n, KeyFunc key, ThreadPool &pool)
+// ʼ: key(e)Ԫe޷ؼ
+// : ̳߳poolkey(e)elemвλȻ,ȶ
+{
+	typedef decltype(key(elem[0])) KeyType;	// ޷ؼ
+	if (n < 2) return;
+	TaskGroup group(pool);
+	ParallelMsdRadixSortHelp(pool, group, elem, n, key, (int)sizeof(KeyType) - 1);
+	group.Wait();
+}
+
+template <class ElemType>
+void ParallelMsdRadixSort(ElemType elem[], int n, ThreadPool &pool)
+// ʼ: ElemTypeΪͻ򸡵
+// : ̳߳poolelemвλȻ
+{
+	ParallelMsdRadixSort(elem, n, RadixDefaultKey(), pool);
+}
+
+template <class ElemType>
+void ParallelMsdRadixSort(ElemType elem[], int n, int threadCount = 0)
+// ʼ: ElemTypeΪͻ򸡵
+// : threadCount̶߳elemвλȻ, threadCountΪ0ʱȡ
+//	Ӳ߳
+{
+	ThreadPool pool(threadCount);
+	ParallelMsdRadixSort(elem, n, RadixDefaultKey(), pool);
+}
+
+// Ļ: depthַΪ256Ͱ,ѽ0Ͱ,Ǳ˴,.
+//	Ǵֵָ,һŴ,зƴ
+struct StringRadixItem
+{
+	const char *str;				// ֵ
+	int index;						// ԭе
+};
+
+inline void StringRadixInsertSort(StringRadixItem item[], int n, int depth)
+// ʼ:ǰdepthַͬ
+// :ӵdepthַȽ,item[0 .. n - 1]ֱӲ
+{
+	for (int i = 1; i < n; i++)
+	{	// iֱӲ
+		StringRadixItem e = item[i];
+		int j;
+		for (j = i - 1; j >= 0 && strcmp(e.str + depth, item[j].str + depth) < 0; j--)
+		{	// eĴ
+			item[j + 1] = item[j];
+		}
+		item[j + 1] = e;
+	}
+}
+
+inline void StringRadixSortHelp(TaskGroup &group, StringRadixItem item[], int n, int depth)
+// ʼ:ǰdepthַͬ
+// :depthԺַitem[0 .. n - 1].ĳַ
+//	ȫͬʱֱһַ,Ͱɱѭ,Ͱn / 2,ʵݹ
+//	Ȳlog n,빫ǰ׺ĳ޹
+{
+	while (n > MSD_RADIX_THRESHOLD)
+	{	// depthַһ
+		int count[256] = {0};				// ͰԪظ
+		for (int i = 0; i < n; i++) count[(unsigned char)item[i].str[depth]]++;
+		int first = (unsigned char)item[0].str[depth];	// ״ĵdepthַ
+		if (count[first] == n)
+		{	// ĵdepthַͬ
+			if (first == 0) return;			// ѽ,˴
+			depth++;
+			continue;
+		}
+
+		int head[256], tail[256];			// ͰһλͰβ
+		for (int v = 0, sum = 0; v < 256; v++)
+		{	// ǰ׺Ͱ
+			head[v] = sum;
+			sum += count[v];
+			tail[v] = sum;
+		}
+		for (int v = 0; v < 256; v++)
+		{	// õvͰ
+			while (head[v] < tail[v])
+			{	// ؽ
+				StringRadixItem e = item[head[v]];
+				int d = (unsigned char)e.str[depth];
+				while (d != v)
+				{	// eͰd,ԭԪ
+					Swap(e, item[head[d]++]);
+					d = (unsigned char)e.str[depth];
+				}
+				item[head[v]++] = e;
+			}
+		}
+
+		int maxV = 1;						// 0ͰͰ
+		for (int v = 2; v < 256; v++) if (count[v] > count[maxV]) maxV = v;
+		for (int v = 1, low = count[0]; v < 256; low += count[v], v++)
+		{	// 0ͰеĴѽ,Ͱѭ,Ͱһַ
+			if (v == maxV || count[v] <= 1) continue;
+			StringRadixItem *bucket = item + low;
+			int size = count[v];
+			if (size > PARALLEL_SORT_GRAIN)
+			{	// ͰΪ
+				group.Run([&group, bucket, size, depth]()
+				{	// һͰ
+					StringRadixSortHelp(group, bucket, size, depth + 1);
+				});
+			}
+			else
+			{	// СͰɱ߳
+				StringRadixSortHelp(group, bucket, size, depth + 1);
+			}
+		}
+
+		item += tail[maxV] - count[maxV];	// Ͱ
+		n = count[maxV];
+		depth++;
+	}
+	StringRadixInsertSort(item, n, depth);	// ֱӲ
+}
+
+inline void ParallelMsdRadixSort(String elem[], int n, ThreadPool &pool)
+// : ̳߳poolԴelemֵвл
+{
+	if (n < 2) return;
+	StringRadixItem *item = new StringRadixItem[n];	// ֵָ
+	for (int i = 0; i < n; i++)
+	{	// ȡֵ
+		item[i].str = elem[i].CStr();
+		item[i].index = i;
+	}
+	{	// 
+		TaskGroup group(pool);
+		StringRadixSortHelp(group, item, n, 0);
+		group.Wait();
+	}
+
+	String *tmpElem = new String[n];		// 
+	for (int i = 0; i < n; i++) tmpElem[i] = elem[item[i].index];
+	for (int i = 0; i < n; i++) elem[i] = tmpElem[i];
+	delete []tmpElem;
+	delete []item;
+}
+
+inline void ParallelMsdRadixSort(String elem[], int n, int threadCount = 0)
+// : threadCount̶߳Դelemֵвл
+{
+	ThreadPool pool(threadCount);
+	ParallelMsdRadixSort(elem, n, pool);
+}
+
+#endif
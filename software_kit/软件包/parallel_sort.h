@@ -0,0 +1,167 @@
+#ifndef __PARALLEL_SORT_H__
+#define __PARALLEL_SORT_H__
+
+#include "utility.h"				// ʵó
+#include "sort_compare.h"			// ȽϺ
+#include "thread_pool.h"			// ̳߳
+#include "quick_sort.h"				// 
+#include "merge_sort.h"				// 鲢
+
+#define PARALLEL_SORT_GRAIN 16384	// гȲֵʱٷֽ,һ߳
+
+// п
+template <class ElemType, class Compare = LessCompare>
+void ParallelQuickSortHelp(TaskGroup &group, ElemType elem[], int low, int high, int depthLimit,
+	Compare comp = Compare())
+// :elem[low .. high]вп,ÿ˻ֺ϶̵ӱΪύ,
+//	ϳӱɱ̼߳,ӱPARALLEL_SORT_GRAINʱʡ
+{
+	while (high - low + 1 > PARALLEL_SORT_GRAIN)
+	{	// нϳ
+		if (depthLimit == 0)
+		{	// ֹ,ö
+			HeapSort(elem + low, high - low + 1, comp);
+			return;
+		}
+		depthLimit--;
+		int pivotLoc = HoarePartition(elem, low, high, comp);	// һ˻
+		int subLow, subHigh;		// Ϊӱ
+		if (pivotLoc - low < high - pivotLoc)
+		{	// ӱ϶
+			subLow = low;
+			subHigh = pivotLoc - 1;
+			low = pivotLoc + 1;
+		}
+		else
+		{	// ӱ϶
+			subLow = pivotLoc + 1;
+			subHigh = high;
+			high = pivotLoc - 1;
+		}
+		group.Run([&group, elem, subLow, subHigh, depthLimit, comp]()
+		{	// ӱ
+			ParallelQuickSortHelp(group, elem, subLow, subHigh, depthLimit, comp);
+		});
+	}
+	IntroSortHelp(elem, low, high, depthLimit, comp);
+	StraightInsertSort(elem + low, high - low + 1, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ParallelQuickSort(ElemType elem[], int n, ThreadPool &pool, Compare comp = Compare())
+// :̳߳poolȽϺcompelemвп
+{
+	int depthLimit = 0;				// 
+	for (int m = n; m > 1; m /= 2)
+	{	// 2logn
+		depthLimit += 2;
+	}
+	TaskGroup group(pool);
+	ParallelQuickSortHelp(group, elem, 0, n - 1, depthLimit, comp);
+	group.Wait();
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ParallelQuickSort(ElemType elem[], int n, int threadCount = 0, Compare comp = Compare())
+// :threadCount̰߳ȽϺcompelemвп, threadCount
+//	Ϊ0ʱȡӲ߳
+{
+	ThreadPool pool(threadCount);
+	ParallelQuickSort(elem, n, pool, comp);
+}
+
+// й鲢
+template <class ElemType, class Compare = LessCompare>
+int CoRank(int k, const ElemType a[], int m, const ElemType b[], int n,
+	Compare comp = Compare())
+// ʼ:a[0 .. m - 1]b[0 .. n - 1], 0 <= k <= m + n
+// :ع鲢ǰkԪaĸi,k - ib;ؼʱa
+//	Ԫǰ,֤ȶ
+{
+	int low = k > n ? k - n : 0, high = k < m ? k : m;	// iȡֵΧ
+	while (low < high)
+	{	// a[mid]ǰkеҽb[k - mid - 1]Сa[mid]
+		int mid = low + (high - low) / 2;
+		if (!comp(b[k - mid - 1], a[mid])) low = mid + 1;
+		else high = mid;
+	}
+	return low;
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ParallelMerge(TaskGroup &group, const ElemType a[], int m, const ElemType b[], int n,
+	ElemType out[], Compare comp = Compare())
+// :a[0 .. m - 1]b[0 .. n - 1]鲢out[0 .. m + n - 1].
+//	PARALLEL_SORT_GRAINֶ,CoRankλΪ鲢
+{
+	for (int k0 = 0; k0 < m + n; k0 += PARALLEL_SORT_GRAIN)
+	{	// out[k0 .. k1 - 1]
+		int k1 = m + n - k0 > PARALLEL_SORT_GRAIN ? k0 + PARALLEL_SORT_GRAIN : m + n;
+		group.Run([a, m, b, n, out, k0, k1, comp]()
+		{	// 鲢һ
+			int i = CoRank(k0, a, m, b, n, comp), j = k0 - i;
+			int iEnd = CoRank(k1, a, m, b, n, comp), jEnd = k1 - iEnd;
+			int k = k0;
+			while (i < iEnd && j < jEnd)
+			{	// ؼʱaԪȹ鲢
+				if (comp(b[j], a[i])) out[k++] = b[j++];
+				else out[k++] = a[i++];
+			}
+			while (i < iEnd) out[k++] = a[i++];
+			while (j < jEnd) out[k++] = b[j++];
+		});
+	}
+	group.Wait();
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ParallelMergeSortHelp(ThreadPool &pool, ElemType elem[], ElemType tmpElem[], int n,
+	bool intoTmp, Compare comp = Compare())
+// :elem[0 .. n - 1]вй鲢,intoTmpΪtrueʱtmpElem,
+//	elem.Ľһ,ٹ鲢,ʡȥ
+{
+	if (n <= PARALLEL_SORT_GRAIN)
+	{	// ɱ߳
+		if (n > 0) MergeSortHelp(elem, tmpElem, 0, n - 1, comp);
+		if (intoTmp)
+		{	// ƵtmpElem
+			for (int i = 0; i < n; i++) tmpElem[i] = elem[i];
+		}
+		return;
+	}
+
+	int half = n / 2;
+	{	// 벢,һ
+		TaskGroup group(pool);
+		group.Run([&pool, elem, tmpElem, half, intoTmp, comp]()
+		{	// ǰһ
+			ParallelMergeSortHelp(pool, elem, tmpElem, half, !intoTmp, comp);
+		});
+		ParallelMergeSortHelp(pool, elem + half, tmpElem + half, n - half, !intoTmp, comp);
+		group.Wait();
+	}
+
+	TaskGroup group(pool);
+	if (intoTmp) ParallelMerge(group, elem, half, elem + half, n - half, tmpElem, comp);
+	else ParallelMerge(group, tmpElem, half, tmpElem + half, n - half, elem, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ParallelMergeSort(ElemType elem[], int n, ThreadPool &pool, Compare comp = Compare())
+// :̳߳poolȽϺcompelemȶĲй鲢
+{
+	ElemType *tmpElem = new ElemType[n];	// ʱ
+	ParallelMergeSortHelp(pool, elem, tmpElem, n, false, comp);
+	delete []tmpElem;						// ͷtmpElemռÿռ
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ParallelMergeSort(ElemType elem[], int n, int threadCount = 0, Compare comp = Compare())
+// :threadCount̰߳ȽϺcompelemȶĲй鲢,
+//	threadCountΪ0ʱȡӲ߳
+{
+	ThreadPool pool(threadCount);
+	ParallelMergeSort(elem, n, pool, comp);
+}
+
+#endif
@@ -0,0 +1,454 @@
+#ifndef __PERFECT_HASH_TABLE_H__
+#define __PERFECT_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+#include "mapped_file.h"							// ڴӳļ
+#include <type_traits>								// is_trivially_copyable
+
+#define PERFECT_HASH_BUCKET_SIZE 6					// ÿͰƽؼָ
+#define PERFECT_HASH_LOAD 0.99						// мַռװ
+#define PERFECT_HASH_MAX_PILOT 65535				// Ͱƫֵ
+#define PERFECT_HASH_MAX_ATTEMPTS 16				// ¹
+#define PERFECT_HASH_VERSION 2						// ļʽ汾,汾1δõӳַΪ-1
+
+// Сɢбļͷ
+struct PerfectHashHeader
+{
+	char magic[4];									// ļʶ"PHT1"
+	int version;									// ļʽ汾
+	int elemSize;									// Ԫصֽ
+	int n;											// Ԫظ
+	int m;											// мַռĴС
+	int bucketCount;								// Ͱ
+	unsigned long long seed;						// ɢ
+	long long pilotOffset;							// Ͱƫļеλ
+	long long remapOffset;							// ӳļеλ
+	long long elemOffset;							// Ԫļеλ
+	unsigned long long checksum;					// ϸУ
+};
+
+// ̬Сɢбģ: CHD/PTHashķΪֻؼּϹ޳ͻɢк,
+//	ؼɢеͰ,ÿͰһ16λƫؼӳ䵽ͬĲ,ֻһ
+//	̽.ַռȡn / 0.99,[n, m)еĹؼ־ӳƵ[0, n)Ŀղ,ʹ
+//	ǡΪn,ԪԼΪÿؼ3λ
+template <class ElemType, class KeyType>
+class PerfectHashTable
+{
+protected:
+//  ɢбݳԱ:
+	const unsigned short *pilot;					// Ͱƫ
+	const int *remap;								// ַm - n,[n, m)еַӳ
+	const ElemType *ht;								// ɢб
+	int n;											// Ԫظ
+	int m;											// мַռĴС
+	int bucketCount;								// Ͱ
+	unsigned long long seed;						// ɢ
+	MappedFile *file;								// ӳļ,ΪNULLʾڶ
+
+//	ģ:
+	unsigned long long Hash(const KeyType &key) const;	// ؼֵɢֵ
+	int Bucket(unsigned long long h) const;			// ɢֵhڵͰ
+	int Slot(unsigned long long h, int p) const;	// ɢֵhƫpµмַ
+	int Position(const KeyType &key) const;			// ؼkeyĲλ
+	bool TryBuild(const ElemType elem[], unsigned short *pil, int *rem);
+		// ԵǰӹͰƫӳ
+	void Clear();									// ͷŴ洢ռ
+	static long long AlignUp(long long offset, long long align);	// ϶
+	static unsigned long long Checksum(const char *data, long long len,
+		unsigned long long sum);					// ۼУ
+
+public:
+//  ɢб:
+	PerfectHashTable();								// ɢб
+	~PerfectHashTable();							// 캯ģ
+	bool Build(const ElemType elem[], int cnt);		// ɻͬԪelem[0 .. cnt - 1]ɢб
+	int Length() const;								// Ԫظ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Save(const char *fileName) const;			// ɢбдļ
+	bool Load(const char *fileName, bool verify = false);	// ӳļ,¹
+
+private:
+	PerfectHashTable(const PerfectHashTable<ElemType, KeyType> &copy);	// ֹ
+	PerfectHashTable<ElemType, KeyType> &operator=
+		(const PerfectHashTable<ElemType, KeyType> &copy);	// ֵֹ
+};
+
+// ɢбģʵֲ
+template <class ElemType, class KeyType>
+unsigned long long PerfectHashTable<ElemType, KeyType>::Hash(const KeyType &key) const
+// : عؼkeyڵǰµɢֵ
+{
+	return HashMix((unsigned long long)key ^ seed);
+}
+
+template <class ElemType, class KeyType>
+int PerfectHashTable<ElemType, KeyType>::Bucket(unsigned long long h) const
+// : ɢֵhڵͰ.ɢֵĸ32λ60%Ĺؼֵַǰ30%Ͱ,
+//	ʹͰɢбϿʱȷƫ,СͰҵղ
+{
+	unsigned long long x = h >> 32;					// 32λ
+	unsigned long long dense = bucketCount * 3ULL / 10 + 1;	// Ͱĸ
+	if (x < 0x99999999ULL)
+	{	// 60%Ĺؼ
+		return (int)(x % dense);
+	}
+	else
+	{	// ؼ
+		return (int)(dense + x % (bucketCount - dense));
+	}
+}
+
+template <class ElemType, class KeyType>
+int PerfectHashTable<ElemType, KeyType>::Slot(unsigned long long h, int p) const
+// : ɢֵhͰƫpµмַ
+{
+	return (int)((h ^ HashMix(seed + p)) % (unsigned long long)m);
+}
+
+template <class ElemType, class KeyType>
+int PerfectHashTable<ElemType, KeyType>::Position(const KeyType &key) const
+// : عؼkeyĲλ
+{
+	unsigned long long h = Hash(key);
+	int pos = Slot(h, pilot[Bucket(h)]);
+	return pos < n ? pos : remap[pos - n];
+}
+
+template <class ElemType, class KeyType>
+PerfectHashTable<ElemType, KeyType>::PerfectHashTable()
+// : ɢб
+{
+	pilot = NULL;
+	remap = NULL;
+	ht = NULL;
+	n = m = bucketCount = 0;
+	seed = 0;
+	file = NULL;
+}
+
+template <class ElemType, class KeyType>
+PerfectHashTable<ElemType, KeyType>::~PerfectHashTable()
+// : ɢб
+{
+	Clear();
+}
+
+template <class ElemType, class KeyType>
+void PerfectHashTable<ElemType, KeyType>::Clear()
+// : ͷŴ洢ռ,ӳļӳ
+{
+	if (file != NULL)
+	{	// ӳ
+		delete file;
+		file = NULL;
+	}
+	else
+	{	// ڶ
+		delete []pilot;
+		delete []remap;
+		delete []ht;
+	}
+	pilot = NULL;
+	remap = NULL;
+	ht = NULL;
+	n = m = bucketCount = 0;
+}
+
+template <class ElemType, class KeyType>
+bool PerfectHashTable<ElemType, KeyType>::TryBuild(const ElemType elem[], unsigned short *pil,
+	int *rem)
+// : ԵǰӹͰƫpilӳrem,ɹtrue,ͰҲƫ
+//	ظؼʱfalse
+{
+	int i, j, b;									// ʱ
+	unsigned long long *h = new unsigned long long[n];	// ؼֵɢֵ
+	int *start = new int[bucketCount + 1];			// Ͱorderеʼλ
+	int *order = new int[n];						// ͰеĹؼ
+	int *bySize = new int[bucketCount];				// ؼָӶൽеͰ
+	int *positions = new int[n];					// ǰͰؼֵмַ
+	bool *taken = new bool[m];						// мַǷռ
+	bool success = true;
+
+	for (b = 0; b <= bucketCount; b++) start[b] = 0;
+	for (i = 0; i < n; i++)
+	{	// ɢֵͳƸͰĹؼָ
+		h[i] = Hash(elem[i]);
+		start[Bucket(h[i]) + 1]++;
+	}
+	for (b = 0; b < bucketCount; b++) start[b + 1] += start[b];
+	int *fill = new int[bucketCount];				// ͰѷĹؼָ
+	for (b = 0; b < bucketCount; b++) fill[b] = 0;
+	for (i = 0; i < n; i++)
+	{	// ,ؼְͰ
+		b = Bucket(h[i]);
+		order[start[b] + fill[b]++] = i;
+	}
+
+	int maxSize = 0;								// Ͱ
+	for (b = 0; b < bucketCount; b++)
+	{	// Ͱ
+		if (fill[b] > maxSize) maxSize = fill[b];
+	}
+	int *sizeStart = new int[maxSize + 2];			// ͰĴС
+	for (i = 0; i <= maxSize + 1; i++) sizeStart[i] = 0;
+	for (b = 0; b < bucketCount; b++) sizeStart[maxSize - fill[b] + 1]++;
+	for (i = 0; i <= maxSize; i++) sizeStart[i + 1] += sizeStart[i];
+	for (b = 0; b < bucketCount; b++) bySize[sizeStart[maxSize - fill[b]]++] = b;
+
+	for (i = 0; i < m; i++) taken[i] = false;
+	for (int k = 0; k < bucketCount && success; k++)
+	{	// ӴͰСͰѰƫ
+		b = bySize[k];
+		int size = start[b + 1] - start[b];
+		if (size == 0)
+		{	// Ͱ
+			pil[b] = 0;
+			continue;
+		}
+		int p;										// ƫ
+		for (p = 0; p <= PERFECT_HASH_MAX_PILOT; p++)
+		{	// ̽ƫp
+			for (i = 0; i < size; i++)
+			{	// Ͱиؼֵмַһͬ
+				positions[i] = Slot(h[order[start[b] + i]], p);
+				if (taken[positions[i]]) break;
+				for (j = 0; j < i && positions[j] != positions[i]; j++);
+				if (j < i) break;
+			}
+			if (i == size) break;					// ҵƫ
+		}
+		if (p > PERFECT_HASH_MAX_PILOT)
+		{	// Ҳƫ
+			success = false;
+		}
+		else
+		{	// ռмַ
+			pil[b] = (unsigned short)p;
+			for (i = 0; i < size; i++) taken[positions[i]] = true;
+		}
+	}
+
+	if (success)
+	{	// [n, m)бռõĵַӳ䵽[0, n)еĿղ
+		int freePos = 0;
+		for (i = n; i < m; i++)
+		{
+			if (taken[i])
+			{	// Ѱһղ
+				while (taken[freePos]) freePos++;
+				rem[i - n] = freePos++;
+			}
+			else
+			{	// δռ,Ĺؼֿڴ˴,ָ0,ɲʱıȽų
+				rem[i - n] = 0;
+			}
+		}
+	}
+
+	delete []h;
+	delete []start;
+	delete []order;
+	delete []bySize;
+	delete []positions;
+	delete []taken;
+	delete []fill;
+	delete []sizeStart;
+	return success;
+}
+
+template <class ElemType, class KeyType>
+bool PerfectHashTable<ElemType, KeyType>::Build(const ElemType elem[], int cnt)
+// : ɻͬԪelem[0 .. cnt - 1]ɢб,ɹtrue,θ
+//	Բܹ(ͨΪظؼ)ʱfalse
+{
+	Clear();										// ԭ
+	n = cnt;
+	m = (int)(n / PERFECT_HASH_LOAD) + 1;			// мַռ1%
+	bucketCount = n / PERFECT_HASH_BUCKET_SIZE + 2;		// гͰϡͰһ
+	unsigned short *pil = new unsigned short[bucketCount];
+	int *rem = new int[m - n];
+
+	for (int attempt = 0; attempt < PERFECT_HASH_MAX_ATTEMPTS; attempt++)
+	{	// ¹
+		seed = HashMix(0x9e3779b97f4a7c15ULL + attempt);
+		if (TryBuild(elem, pil, rem))
+		{	// ɹ,λôԪ
+			pilot = pil;
+			remap = rem;
+			ElemType *table = new ElemType[n];
+			for (int i = 0; i < n; i++) table[Position(elem[i])] = elem[i];
+			ht = table;
+			return true;
+		}
+	}
+
+	delete []pil;									// ʧ
+	delete []rem;
+	n = m = bucketCount = 0;
+	return false;
+}
+
+template <class ElemType, class KeyType>
+int PerfectHashTable<ElemType, KeyType>::Length() const
+// : Ԫظ
+{
+	return n;
+}
+
+template <class ElemType, class KeyType>
+void PerfectHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζɢбÿԪصú(*visit)
+{
+	for (int pos = 0; pos < n; pos++)
+	{	// ɢбÿԪصú(*visit)
+		(*visit)(ht[pos]);
+	}
+}
+
+template <class ElemType, class KeyType>
+bool PerfectHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false.ɢкԼĹؼҲһλ,ȽԪر
+{
+	if (n == 0) return false;						// ձ
+	int pos = Position(key);						// Ψһܵλ
+	if (ht[pos] == key)
+	{	// ҳɹ
+		e = ht[pos];
+		return true;
+	}
+	else
+	{	// ʧ
+		return false;
+	}
+}
+
+template <class ElemType, class KeyType>
+long long PerfectHashTable<ElemType, KeyType>::AlignUp(long long offset, long long align)
+// : زСoffsetalignı
+{
+	return (offset + align - 1) / align * align;
+}
+
+template <class ElemType, class KeyType>
+unsigned long long PerfectHashTable<ElemType, KeyType>::Checksum(const char *data, long long len,
+	unsigned long long sum)
+// : data[0 .. len - 1]ۼӵУsum(FNV-1a)
+{
+	for (long long i = 0; i < len; i++)
+	{	// ֽۼ
+		sum = (sum ^ (unsigned char)data[i]) * 0x100000001b3ULL;
+	}
+	return sum;
+}
+
+template <class ElemType, class KeyType>
+bool PerfectHashTable<ElemType, KeyType>::Save(const char *fileName) const
+// : ɢбдļfileName,鰴̶ִ,Loadֱӳ,
+//	ɹtrue,򷵻false
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "Ԫɰֽڸ");
+
+	PerfectHashHeader header;						// ļͷ
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "PHT1", 4);
+	header.version = PERFECT_HASH_VERSION;
+	header.elemSize = (int)sizeof(ElemType);
+	header.n = n;
+	header.m = m;
+	header.bucketCount = bucketCount;
+	header.seed = seed;
+	header.pilotOffset = AlignUp(sizeof(header), 64);
+	header.remapOffset = AlignUp(header.pilotOffset + (long long)bucketCount * sizeof(unsigned short), 64);
+	header.elemOffset = AlignUp(header.remapOffset + (long long)(m - n) * sizeof(int), 64);
+	unsigned long long sum = 0xcbf29ce484222325ULL;
+	sum = Checksum((const char *)pilot, (long long)bucketCount * sizeof(unsigned short), sum);
+	sum = Checksum((const char *)remap, (long long)(m - n) * sizeof(int), sum);
+	sum = Checksum((const char *)ht, (long long)n * sizeof(ElemType), sum);
+	header.checksum = sum;
+
+	ofstream outFile(fileName, ios::binary);		// ļ
+	if (!outFile) return false;
+	char zero[64] = {0};							// 
+	outFile.write((const char *)&header, sizeof(header));
+	outFile.write(zero, header.pilotOffset - sizeof(header));
+	outFile.write((const char *)pilot, (long long)bucketCount * sizeof(unsigned short));
+	outFile.write(zero, header.remapOffset - header.pilotOffset
+		- (long long)bucketCount * sizeof(unsigned short));
+	outFile.write((const char *)remap, (long long)(m - n) * sizeof(int));
+	outFile.write(zero, header.elemOffset - header.remapOffset - (long long)(m - n) * sizeof(int));
+	outFile.write((const char *)ht, (long long)n * sizeof(ElemType));
+	return (bool)outFile;
+}
+
+template <class ElemType, class KeyType>
+bool PerfectHashTable<ElemType, KeyType>::Load(const char *fileName, bool verify)
+// : ֻʽӳSaveдļfileName,ֱʹе¹,
+//	ɹtrue,ļ,ʽУʹʱfalse.verifyΪtrueʱ
+//	ȫ֤У,ҳ״βʱŵ
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "Ԫɰֽڸ");
+
+	Clear();										// ԭ
+	MappedFile *mapped = new MappedFile;
+	if (!mapped->Open(fileName) || mapped->Size() < (long long)sizeof(PerfectHashHeader))
+	{	// ޷ӳ
+		delete mapped;
+		return false;
+	}
+
+	const char *base = mapped->Data();
+	const PerfectHashHeader *header = (const PerfectHashHeader *)base;
+	long long size = mapped->Size();				// ļֽ
+	const long long headerSize = (long long)sizeof(PerfectHashHeader);	// ļͷֽ
+	if (memcmp(header->magic, "PHT1", 4) != 0 || header->version != PERFECT_HASH_VERSION ||
+		header->elemSize != (int)sizeof(ElemType) || header->n < 0 || header->m <= header->n ||
+		header->bucketCount < 2 ||
+		header->pilotOffset < headerSize ||
+		header->pilotOffset % (long long)sizeof(unsigned short) != 0 ||
+		header->pilotOffset > size - header->bucketCount * (long long)sizeof(unsigned short) ||
+		header->remapOffset < headerSize ||
+		header->remapOffset % (long long)sizeof(int) != 0 ||
+		header->remapOffset > size - (header->m - header->n) * (long long)sizeof(int) ||
+		header->elemOffset < headerSize ||
+		header->elemOffset % (long long)alignof(ElemType) != 0 ||
+		header->elemOffset > size - header->n * (long long)sizeof(ElemType))
+	{	// ʽ
+		delete mapped;
+		return false;
+	}
+	const int *remapSlots = (const int *)(base + header->remapOffset);	// λӳ
+	for (int i = 0; header->n > 0 && i < header->m - header->n; i++)
+	{	// ӳָʵʵĲ,һԽ,ʹ֤УҲ.ձ,ؼ
+		if (remapSlots[i] < 0 || remapSlots[i] >= header->n)
+		{	// ʽ
+			delete mapped;
+			return false;
+		}
+	}
+	if (verify)
+	{	// ֤У
+		unsigned long long sum = 0xcbf29ce484222325ULL;
+		sum = Checksum(base + header->pilotOffset, (long long)header->bucketCount * sizeof(unsigned short), sum);
+		sum = Checksum(base + header->remapOffset, (long long)(header->m - header->n) * sizeof(int), sum);
+		sum = Checksum(base + header->elemOffset, (long long)header->n * sizeof(ElemType), sum);
+		if (sum != header->checksum)
+		{	// Уʹ
+			delete mapped;
+			return false;
+		}
+	}
+
+	file = mapped;
+	n = header->n;
+	m = header->m;
+	bucketCount = header->bucketCount;
+	seed = header->seed;
+	pilot = (const unsigned short *)(base + header->pilotOffset);
+	remap = (const int *)(base + header->remapOffset);
+	ht = (const ElemType *)(base + header->elemOffset);
+	return true;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef __QUICK_SELECT_H__
+#define __QUICK_SELECT_H__
+
+#include "utility.h"				// ʵó
+#include "sort_compare.h"			// ȽϺ
+#include "quick_sort.h"				// Ļ
+#include "heap_sort.h"				// 
+#include "straight_insert_sort.h"	// ֱӲ
+
+#define SELECT_THRESHOLD 16			// гȲֵʱֱ
+#define SELECT_GROUP 5				// ֵֵ㷨ÿԪظ
+
+// ʡѡ: ͬػ,ֻڵkԪڵһ,ȽϴΪO(n).
+//	ÿ˻ֺг,δ˵ѡȡ,˺ֵֵѡȡ,
+//	֤ҲO(n).ȵԪ˶ͣ½,ظԪʱȻ
+
+template <class ElemType, class Compare>
+void SelectHelp(ElemType elem[], int low, int high, int k, bool guaranteed, Compare comp);
+	// elem[low .. high]ѡkԪ,guaranteedΪtrueʱֵֵֻѡȡ
+
+template <class ElemType, class Compare = LessCompare>
+int MedianOfMedians(ElemType elem[], int low, int high, Compare comp = Compare())
+// ʼ:high - low + 1 > SELECT_THRESHOLD
+// :elem[low .. high]ÿSELECT_GROUPΪһ,ֵƵ
+//	ǰ,ٵݹѡЩֵֵ,λ.Լ3/10ԪزС,ҲԼ3/10
+//	Ԫز
+{
+	int cnt = 0;						// ֵĸ
+	for (int i = low; i + SELECT_GROUP - 1 <= high; i += SELECT_GROUP)
+	{	// cntelem[i .. i + SELECT_GROUP - 1]
+		StraightInsertSort(elem + i, SELECT_GROUP, comp);
+		Swap(elem[low + cnt], elem[i + SELECT_GROUP / 2]);	// ֵƵǰ
+		cnt++;
+	}
+	int mid = low + (cnt - 1) / 2;		// ֵֵλ
+	SelectHelp(elem, low, low + cnt - 1, mid, true, comp);
+	return mid;
+}
+
+template <class ElemType, class Compare>
+void SelectHelp(ElemType elem[], int low, int high, int k, bool guaranteed, Compare comp)
+// ʼ:low <= k <= high
+// :elem[low .. high],ʹelem[k]ΪӦڸλõԪ,ǰԪض
+//	,ԪضС
+{
+	int checkLength = high - low + 1;	// ϴμʱг
+	int steps = 0;						// ϴμĻ
+	while (high - low + 1 > SELECT_THRESHOLD)
+	{	// elem[low .. high]ϳ
+		int pivotLoc;
+		if (guaranteed)
+		{	// ֵֵ,ÿȥԼ3/10Ԫ
+			pivotLoc = HoarePartitionAt(elem, low, high, MedianOfMedians(elem, low, high, comp), comp);
+		}
+		else
+		{	// ȡлȡ
+			pivotLoc = HoarePartition(elem, low, high, comp);
+		}
+
+		if (k == pivotLoc) return;		// ǡΪkԪ
+		if (k < pivotLoc) high = pivotLoc - 1;	// ӱм
+		else low = pivotLoc + 1;		// ӱм
+
+		if (!guaranteed && ++steps == 2)
+		{	// ÿ˼һгǷ
+			if (2 * (high - low + 1) > checkLength) guaranteed = true;
+			checkLength = high - low + 1;
+			steps = 0;
+		}
+	}
+	if (low < high) StraightInsertSort(elem + low, high - low + 1, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+void NthElement(ElemType elem[], int n, int k, Compare comp = Compare())
+// ʼ:0 <= k < n
+// :ȽϺcompelem,ʹelem[k]ΪӦڸλõԪ,ǰ
+//	Ԫض,ԪضС,ʡѡ,ʱ临ӶΪO(n)
+{
+	if (k < 0 || k >= n) return;
+	SelectHelp(elem, 0, n - 1, k, false, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+void PartialSort(ElemType elem[], int n, int k, Compare comp = Compare())
+// :ȽϺcompelem,ʹelem[0 .. k - 1]ΪǰkԪ
+//	,Ԫشȷ.ʡѡֳǰkԪ,ٶ,ʱ临ӶΪ
+//	O(n + klogk)
+{
+	if (k > n) k = n;
+	if (k <= 0) return;
+	if (k < n) NthElement(elem, n, k - 1, comp);	// elem[0 .. k - 1]ΪСkԪ
+	HeapSort(elem, k, comp);
+}
+
+#endif
@@ -2,22 +2,29 @@
 #define __QUICK_SORT_H__
 
 #include "utility.h"			// ʵó
+#include "sort_compare.h"		// ȽϺ
+#include "heap_sort.h"			// 
+#include "straight_insert_sort.h"	// ֱӲ
+#include "sorting_network.h"	// 
 
-template <class ElemType>
-int Partition(ElemType elem[], int low, int high)
+#define INTRO_SORT_THRESHOLD 16	// гȲֵʱֱӲ
+#define NINTHER_THRESHOLD 128	// гȳֵʱþȡѡ
+
+template <class ElemType, class Compare = LessCompare>
+int Partition(ElemType elem[], int low, int high, Compare comp = Compare())
 // :elem[low .. high]еԪ,ʹƶʵ,Ҫ֮ǰԪ
 //	,֮ԪزС,λ
 
 {
 	while (low < high)
 	{
-		while (low < high && elem[high] >= elem[low])
+		while (low < high && !comp(elem[high], elem[low]))
 		{	// elem[low]Ϊ,ʹhighұߵԪزСelem[low]
 			high--;
 		}
 		Swap(elem[low], elem[high]);
 
-		while (low < high && elem[low] <= elem[high])
+		while (low < high && !comp(elem[high], elem[low]))
 		{	// elem[high]Ϊ,ʹlowߵԪزelem[high]
 			low++;
 		}
@@ -26,23 +33,130 @@ int Partition(ElemType elem[], int low, int high)
 	return low;	// λ
 }
 
-template <class ElemType>
-void QuickSortHelp(ElemType elem[], int low, int high)
-// :elem[low .. high]еļ¼п
+template <class ElemType, class Compare = LessCompare>
+void QuickSortHelp(ElemType elem[], int low, int high, Compare comp = Compare())
+// :elem[low .. high]еļ¼п,
+{
+	if (high - low + 1 <= NETWORK_SORT_THRESHOLD)
+	{	// 
+		NetworkSort(elem + low, high - low + 1, comp);
+	}
+	else
+	{	// elem[low .. high]ϳ
+		int pivotLoc = Partition(elem, low, high, comp);	// һ˻
+		QuickSortHelp(elem, low, pivotLoc - 1, comp);	// ӱelem[low, pivotLoc - 1]ݹ
+		QuickSortHelp(elem, pivotLoc + 1, high, comp);	// ӱelem[pivotLoc + 1, high]ݹ
+	}
+}
+
+template <class ElemType, class Compare = LessCompare>
+void QuickSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemп
+{
+	QuickSortHelp(elem, 0, n - 1, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+int MedianOfThree(ElemType elem[], int a, int b, int c, Compare comp = Compare())
+// :elem[a], elem[b], elem[c]дСߵ±
+{
+	if (comp(elem[a], elem[b]))
+	{	// elem[a] < elem[b]
+		if (comp(elem[b], elem[c])) return b;
+		return comp(elem[a], elem[c]) ? c : a;
+	}
+	else
+	{	// elem[b] <= elem[a]
+		if (comp(elem[a], elem[c])) return a;
+		return comp(elem[b], elem[c]) ? c : b;
+	}
+}
+
+template <class ElemType, class Compare = LessCompare>
+int HoarePartitionAt(ElemType elem[], int low, int high, int pivotLoc, Compare comp = Compare())
+// ʼ:elem[low .. high]гelem[pivotLoc]⻹вСԪ
+// :elem[pivotLoc]Ϊ,ɨ,Ԫض,ʹ֮ǰԪ
+//	,֮ԪزС,λ.ȵԪ˶ͣ
+//	,ʴظԪʱȻ
 {
-	if (low < high)
-	{	// elem[low .. high]ȴ1
-		int pivotLoc = Partition(elem, low, high);	// һ˻
-		QuickSortHelp(elem, low, pivotLoc - 1);		// ӱelem[low, pivotLoc - 1]ݹ
-		QuickSortHelp(elem, pivotLoc + 1, high);	// ӱelem[pivotLoc + 1, high]ݹ
+	Swap(elem[low], elem[pivotLoc]);	// Ƶelem[low]
+
+	ElemType pivot = elem[low];			// 
+	int i = low, j = high + 1;
+	while (true)
+	{	// ҲвСԪ,˵ֵסj,ɨ費ؼ±
+		while (comp(elem[++i], pivot));		// СԪ
+		while (comp(pivot, elem[--j]));		// Ԫ
+		if (i >= j) break;
+		Swap(elem[i], elem[j]);			// 
+	}
+	Swap(elem[low], elem[j]);			// λ
+	return j;
+}
+
+template <class ElemType, class Compare = LessCompare>
+int HoarePartition(ElemType elem[], int low, int high, Compare comp = Compare())
+// ʼ:high - low >= 2
+// :ȡ(þȡ)ѡȡ,HoarePartitionAt,
+//	λ.Ϊֵ,вСԪ
+{
+	int mid = low + (high - low) / 2, pivotLoc;
+	if (high - low + 1 > NINTHER_THRESHOLD)
+	{	// ȡ
+		int step = (high - low + 1) / 8;
+		pivotLoc = MedianOfThree(elem,
+			MedianOfThree(elem, low, low + step, low + 2 * step, comp),
+			MedianOfThree(elem, mid - step, mid, mid + step, comp),
+			MedianOfThree(elem, high - 2 * step, high - step, high, comp), comp);
+	}
+	else
+	{	// ȡ
+		pivotLoc = MedianOfThree(elem, low, mid, high, comp);
+	}
+	return HoarePartitionAt(elem, low, high, pivotLoc, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+void IntroSortHelp(ElemType elem[], int low, int high, int depthLimit,
+	Compare comp = Compare())
+// :elem[low .. high]ʡ,ȲINTRO_SORT_THRESHOLD
+//	ֱӲ
+{
+	while (high - low + 1 > INTRO_SORT_THRESHOLD)
+	{	// elem[low .. high]ϳ
+		if (depthLimit == 0)
+		{	// ֹ,˵ѡȡ,ö֤O(nlogn)
+			HeapSort(elem + low, high - low + 1, comp);
+			return;
+		}
+		depthLimit--;
+		int pivotLoc = HoarePartition(elem, low, high, comp);	// һ˻
+		if (pivotLoc - low < high - pivotLoc)
+		{	// ݹ϶̵ӱ,ѭϳӱ,ʹջΪO(logn)
+			IntroSortHelp(elem, low, pivotLoc - 1, depthLimit, comp);
+			low = pivotLoc + 1;
+		}
+		else
+		{	// ݹ϶̵ӱ,ѭϳӱ
+			IntroSortHelp(elem, pivotLoc + 1, high, depthLimit, comp);
+			high = pivotLoc - 1;
+		}
 	}
 }
 
-template <class ElemType>
-void QuickSort(ElemType elem[], int n)
-// :elemп
+template <class ElemType, class Compare = LessCompare>
+void IntroSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemʡ:ȡлȡеĿ,
+//	ȳ2lognʱö,ͳһֱӲ.ʱ临ӶΪO(nlogn),
+//	ջΪO(logn)
 {
-	QuickSortHelp(elem, 0, n - 1);
+	int depthLimit = 0;					// 
+	for (int m = n; m > 1; m /= 2)
+	{	// 2logn
+		depthLimit += 2;
+	}
+	IntroSortHelp(elem, 0, n - 1, depthLimit, comp);
+	StraightInsertSort(elem, n, comp);		// Ѿλ,ֻڶƶԪ
 }
 
 #endif
@@ -0,0 +1,293 @@
+#ifndef __ROBIN_HOOD_HASH_TABLE_H__
+#define __ROBIN_HOOD_HASH_TABLE_H__
+
+#include "utility.h"								// ʵó
+
+// Robin Hoodɢбģ
+template <class ElemType, class KeyType>
+class RobinHoodHashTable
+{
+protected:
+//  ɢбݳԱ:
+	ElemType *ht;									// ɢб
+	int *dist;										// Ԫɢеַľ,-1ʾղ
+	int m;											// ɢб,Ϊ2
+	int count;										// Ԫظ
+	int maxDist;									// ֵ̽
+
+//	ģ:
+	int H(const KeyType &key) const;				// ɢкģ
+	bool SearchHelp(const KeyType &key, int &pos) const;	// ѰؼΪkeyԪصλ
+	void InsertHelp(const ElemType &e);				// ȷ֪ڵԪe
+	void Init(int size);							// ʼΪsizeĿɢб
+	void Rehash(int size);							// ɢбؽΪsize
+
+public:
+//  ɢбرϵͳĬϷ:
+	RobinHoodHashTable(int size = DEFAULT_SIZE);	// 캯ģ
+	~RobinHoodHashTable();							// 캯ģ
+	int Length() const;								// Ԫظ
+	void Traverse(void (*visit)(const ElemType &)) const;	// ɢб
+	bool Search(const KeyType &key, ElemType &e) const ;	// ѰؼΪkeyԪصֵ
+	bool Insert(const ElemType &e);					// Ԫe
+	bool Delete(const KeyType &key);				// ɾؼΪkeyԪ
+	int MaxProbeLength() const;						// ǰ̽鳤
+	void ProbeHistogram(int hist[], int n) const;	// ͳƸ̽鳤ȵԪظ
+	RobinHoodHashTable(const RobinHoodHashTable<ElemType, KeyType> &copy);	// ƹ캯ģ
+	RobinHoodHashTable<ElemType, KeyType> &operator=
+		(const RobinHoodHashTable<ElemType, KeyType> &copy);	// ظֵ
+};
+
+// Robin Hoodɢбģʵֲ
+template <class ElemType, class KeyType>
+int RobinHoodHashTable<ElemType, KeyType>::H(const KeyType &key) const
+// : ɢеַ
+{
+	return (int)(HashMix((unsigned long long)key) & (m - 1));
+}
+
+template <class ElemType, class KeyType>
+void RobinHoodHashTable<ElemType, KeyType>::Init(int size)
+// : ʼΪsizeĿɢб
+{
+	m = size;										// ɢб
+	count = 0;										// ɢбԪظΪ0
+	maxDist = 0;									// ̽
+	ht = new ElemType[m];							// 洢ռ
+	dist = new int[m];								// 洢ռ
+	for (int pos = 0; pos < m; pos++)
+	{	// вÿ
+		dist[pos] = -1;
+	}
+}
+
+template <class ElemType, class KeyType>
+RobinHoodHashTable<ElemType, KeyType>::RobinHoodHashTable(int size)
+// : һٿsizeԪصĿɢб,װӲ0.9
+{
+	int capacity = 16;
+	while (capacity / 10 * 9 < size)
+	{	// ȡ2
+		capacity *= 2;
+	}
+	Init(capacity);
+}
+
+template <class ElemType, class KeyType>
+RobinHoodHashTable<ElemType, KeyType>::~RobinHoodHashTable()
+// : ɢб
+{
+	delete []ht;									// ͷht
+	delete []dist;									// ͷdist
+}
+
+template <class ElemType, class KeyType>
+int RobinHoodHashTable<ElemType, KeyType>::Length() const
+// : Ԫظ
+{
+	return count;
+}
+
+template <class ElemType, class KeyType>
+void RobinHoodHashTable<ElemType, KeyType>::Traverse(void (*visit)(const ElemType &)) const
+// : ζɢбÿԪصú(*visit)
+{
+	for (int pos = 0; pos < m; pos++)
+	{	// ɢбÿԪصú(*visit)
+		if (dist[pos] >= 0)
+		{	// Ԫطǿ
+			(*visit)(ht[pos]);
+		}
+	}
+}
+
+template <class ElemType, class KeyType>
+bool RobinHoodHashTable<ElemType, KeyType>::SearchHelp(const KeyType &key, int &pos) const
+// : ѰؼΪkeyԪصλ,ҳɹ,true,posָʾ
+//	Ԫɢбλ,򷵻false.ڸԪذ̽,ղۻ
+//	̽СڵǰĲۼжʧ
+{
+	pos = H(key);									// ɢеַ
+	for (int d = 0; d <= maxDist; d++)
+	{	// dΪǰ̽
+		if (dist[pos] < d)
+		{	// ղۻɢеַԪ,ʧ
+			return false;
+		}
+		if (dist[pos] == d && ht[pos] == key)
+		{	// ҳɹ
+			return true;
+		}
+		pos = (pos + 1) & (m - 1);					// һַ̽
+	}
+	return false;									// ̽,ʧ
+}
+
+template <class ElemType, class KeyType>
+void RobinHoodHashTable<ElemType, KeyType>::InsertHelp(const ElemType &e)
+// ʼ: ɢбвԪeпղ
+// : Ԫe,̽ȴԪظɢеַԪʱ,֮
+{
+	ElemType cur = e;								// Ԫ
+	int d = 0;										// Ԫص̽
+	int pos = H(cur);								// ַ̽
+
+	while (dist[pos] >= 0)
+	{	// ۷ǿ
+		if (dist[pos] < d)
+		{	// ٸƶ: Ԫռݸò,ԭԪؼ̽
+			Swap(cur, ht[pos]);
+			Swap(d, dist[pos]);
+			if (dist[pos] > maxDist) maxDist = dist[pos];
+		}
+		pos = (pos + 1) & (m - 1);
+		d++;
+	}
+	ht[pos] = cur;									// ղ
+	dist[pos] = d;
+	if (d > maxDist) maxDist = d;
+	count++;
+}
+
+template <class ElemType, class KeyType>
+void RobinHoodHashTable<ElemType, KeyType>::Rehash(int size)
+// : ɢбؽΪsize
+{
+	ElemType *oldHt = ht;							// ԭɢб
+	int *oldDist = dist;							// ԭ̽
+	int oldM = m;									// ԭ
+
+	Init(size);										// ʼɢб
+	for (int pos = 0; pos < oldM; pos++)
+	{	// ԭɢбԪزɢб
+		if (oldDist[pos] >= 0) InsertHelp(oldHt[pos]);
+	}
+	delete []oldHt;									// ͷԭɢб
+	delete []oldDist;								// ͷԭ̽
+}
+
+template <class ElemType, class KeyType>
+bool RobinHoodHashTable<ElemType, KeyType>::Search(const KeyType &key, ElemType &e) const
+// : ѰؼΪkeyԪصֵ,ҳɹ,true,eԪصֵ,
+//	򷵻false
+{
+	int pos;										// Ԫصλ
+	if (SearchHelp(key, pos))
+	{	// ҳɹ
+		e = ht[pos];								// eԪֵ
+		return true;								// true
+	}
+	else
+	{	// ʧ
+		return false;								// false
+	}
+}
+
+template <class ElemType, class KeyType>
+bool RobinHoodHashTable<ElemType, KeyType>::Insert(const ElemType &e)
+// : ɢбвԪe,ɹtrue,ԪѴڷfalse,
+//	װӳ0.9ʱӱ
+{
+	int pos;										// Ԫλ
+	if (SearchHelp(e, pos))
+	{	// ԪѴ,ʧ
+		return false;
+	}
+	if (count + 1 > m / 10 * 9)
+	{	// װ,ӱ
+		Rehash(2 * m);
+	}
+	InsertHelp(e);									// Ԫ
+	return true;
+}
+
+template <class ElemType, class KeyType>
+bool RobinHoodHashTable<ElemType, KeyType>::Delete(const KeyType &key)
+// : ɾؼΪkeyԪ,ɾɹtrue,򷵻false.ɾ
+//	̽0Ԫǰһλ,˲Ҫɾ
+{
+	int pos;										// Ԫλ
+	if (!SearchHelp(key, pos))
+	{	// ɾʧ
+		return false;
+	}
+
+	int next = (pos + 1) & (m - 1);
+	while (dist[next] > 0)
+	{	// Ԫزɢеַ,ǰһλ
+		ht[pos] = ht[next];
+		dist[pos] = dist[next] - 1;
+		pos = next;
+		next = (next + 1) & (m - 1);
+	}
+	dist[pos] = -1;									// ÿ
+	count--;
+	return true;
+}
+
+template <class ElemType, class KeyType>
+int RobinHoodHashTable<ElemType, KeyType>::MaxProbeLength() const
+// : صǰԪֵ̽
+{
+	int result = 0;
+	for (int pos = 0; pos < m; pos++)
+	{	// ̽
+		if (dist[pos] > result) result = dist[pos];
+	}
+	return result;
+}
+
+template <class ElemType, class KeyType>
+void RobinHoodHashTable<ElemType, KeyType>::ProbeHistogram(int hist[], int n) const
+// : hist[i]̽ΪiԪظ(0 <= i < n - 1), hist[n - 1]
+//	̽벻Сn - 1Ԫظ
+{
+	for (int i = 0; i < n; i++)
+	{	// 
+		hist[i] = 0;
+	}
+	for (int pos = 0; pos < m; pos++)
+	{	// ͳƸԪص̽
+		if (dist[pos] >= 0)
+		{	// Ԫطǿ
+			hist[dist[pos] < n - 1 ? dist[pos] : n - 1]++;
+		}
+	}
+}
+
+template <class ElemType, class KeyType>
+RobinHoodHashTable<ElemType, KeyType>::RobinHoodHashTable(const RobinHoodHashTable<ElemType, KeyType> &copy)
+// ɢбcopyɢбƹ캯ģ
+{
+	Init(copy.m);									// ʼɢб
+	count = copy.count;								// Ԫظ
+	maxDist = copy.maxDist;							// ̽
+	for (int pos = 0; pos < m; pos++)
+	{	// Ԫ
+		ht[pos] = copy.ht[pos];						// Ԫ
+		dist[pos] = copy.dist[pos];					// ̽
+	}
+}
+
+template <class ElemType, class KeyType>
+RobinHoodHashTable<ElemType, KeyType> &RobinHoodHashTable<ElemType, KeyType>::
+operator=(const RobinHoodHashTable<ElemType, KeyType> &copy)
+// ɢбcopyֵǰɢбظֵ
+{
+	if (&copy != this)
+	{
+		delete []ht;								// ͷŵǰɢб洢ռ
+		delete []dist;
+		Init(copy.m);								// ʼɢб
+		count = copy.count;
+		maxDist = copy.maxDist;
+		for (int pos = 0; pos < m; pos++)
+		{	// Ԫ
+			ht[pos] = copy.ht[pos];
+			dist[pos] = copy.dist[pos];
+		}
+	}
+	return *this;
+}
+
+#endif
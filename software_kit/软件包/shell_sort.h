@@ -1,8 +1,17 @@
 #ifndef __SHELL_SORT_H__
 #define __SHELL_SORT_H__
 
-template <class ElemType>
-void ShellInsert(ElemType elem[], int n, int incr)
+#include "sort_compare.h"		// ȽϺ
+#include "simd_support.h"		// SIMDָ֧
+
+#define SHELL_MAX_GAPS 32		// е󳤶
+#define SHELL_INTERLEAVE 8		// Shellͬʱи(Ĵintĸ)
+
+// Ciuraʵ,һԼ2.25õ
+static const int SHELL_CIURA_GAPS[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+
+template <class ElemType, class Compare = LessCompare>
+void ShellInsert(ElemType elem[], int n, int incr, Compare comp = Compare())
 // : elemһΪincrShell,Բ޸
 //	ǰڼ¼Ϊincr,1
 {
@@ -10,7 +19,7 @@ void ShellInsert(ElemType elem[], int n, int incr)
 	{	// i˲
 		ElemType e = elem[i];			// ݴelem[i]
 		int j;							// ʱ
-		for (j = i - incr; j >= 0 && e < elem[j]; j -= incr)
+		for (j = i - incr; j >= 0 && comp(e, elem[j]); j -= incr)
 		{	// бeļ¼
 			elem[j + incr] = elem[j];	// 
 		}
@@ -18,13 +27,133 @@ void ShellInsert(ElemType elem[], int n, int incr)
 	}
 }
 
-template <class ElemType>
-void ShellSort(ElemType elem[], int n, int inc[], int t)
-// : inc[0 .. t -1 ]elemShell
+template <class ElemType, class Compare = LessCompare>
+void ShellSort(ElemType elem[], int n, int inc[], int t, Compare comp = Compare())
+// : inc[0 .. t -1 ]ͱȽϺcompelemShell
 {
 	for ( int k = 0 ; k < t; k++)
 	{	// kShell
-		ShellInsert(elem, n, inc[k]);
+		ShellInsert(elem, n, inc[k], comp);
+	}
+}
+
+inline int ShellGaps(int n, int inc[])
+// : incʺ϶nԪĵݼ,1,.ȡ
+//	SHELL_CIURA_GAPSСnĸ,nʱ1750γ2.25
+{
+	int gap[SHELL_MAX_GAPS], t = 0;		// 
+	const int ciuraCount = sizeof(SHELL_CIURA_GAPS) / sizeof(SHELL_CIURA_GAPS[0]);
+	for (; t < ciuraCount && (t == 0 || SHELL_CIURA_GAPS[t] < n); t++)
+	{	// Ciura
+		gap[t] = SHELL_CIURA_GAPS[t];
+	}
+	if (t == ciuraCount)
+	{	// 2.25
+		for (long long g = gap[t - 1] * 9LL / 4; g < n && t < SHELL_MAX_GAPS; g = g * 9 / 4)
+		{	// һ
+			gap[t++] = (int)g;
+		}
+	}
+	for (int k = 0; k < t; k++)
+	{	// Ϊݼ
+		inc[k] = gap[t - 1 - k];
+	}
+	return t;
+}
+
+template <class ElemType, class Compare = LessCompare>
+void ShellSort(ElemType elem[], int n, Compare comp = Compare())
+// : ShellGapsԶѡȡкͱȽϺcompelemShell
+{
+	int inc[SHELL_MAX_GAPS];
+	int t = ShellGaps(n, inc);
+	ShellSort(elem, n, inc, t, comp);
+}
+
+#ifdef SIMD_AVX2_DISPATCH
+SIMD_TARGET_AVX2 inline int ShellInsertAvx2(int elem[], int n, int incr)
+// ʼ: incr >= SHELL_INTERLEAVE
+// : һΪincrShell,8Ԫطͬ,һĴͬʱ
+//	,δĵһԪص.ѲĲ,ĳһֹͣ,
+//	ԺıȽ϶Ҫ,ʸɰͬһͬƽ
+{
+	int i = incr;
+	for (; i + 8 <= n; i += 8)
+	{	// ͬʱelem[i .. i + 7]
+		__m256i e = _mm256_loadu_si256((const __m256i *)(elem + i));	// Ԫ
+		__m256i hole = _mm256_set1_epi32(-1);	// λelem[j + incr]ĵ
+		int j = i - incr;
+		while (true)
+		{	// Ƚelem[j .. j + 7],ϴߺƵλ,ڿλe
+			__m256i p = _mm256_loadu_si256((const __m256i *)(elem + j));
+			__m256i shift = _mm256_cmpgt_epi32(p, e);	// ҪƵĵ
+			__m256i cur = _mm256_loadu_si256((const __m256i *)(elem + j + incr));
+			cur = _mm256_blendv_epi8(_mm256_blendv_epi8(cur, e, hole), p, shift);
+			_mm256_storeu_si256((__m256i *)(elem + j + incr), cur);
+			if (_mm256_testz_si256(shift, shift)) break;	// Ѳ
+			hole = shift;
+			j -= incr;
+			if (j < 0)
+			{	// гȲͬ,ҪƵĵ
+				int ev[8];
+				_mm256_storeu_si256((__m256i *)ev, e);
+				int mask = _mm256_movemask_ps(_mm256_castsi256_ps(shift));
+				for (int w = 0; w < 8; w++)
+				{	// w,λelem[j + incr + w]
+					if ((mask >> w & 1) == 0) continue;
+					int pos = j + incr + w;
+					for (; pos - incr >= 0 && ev[w] < elem[pos - incr]; pos -= incr)
+					{	// 
+						elem[pos] = elem[pos - incr];
+					}
+					elem[pos] = ev[w];
+				}
+				break;
+			}
+		}
+	}
+	return i;
+}
+#endif
+
+inline void ShellInsertInterleaved(int elem[], int n, int incr)
+// : elemһΪincrShell.incrСSHELL_INTERLEAVEҴ
+//	֧AVX2ʱͬʱڵ8Ԫ,Ƿͬ,Ƚƶ;Ԫ
+//	
+{
+	int i = incr;
+#ifdef SIMD_AVX2_DISPATCH
+	if (HasAvx2() && incr >= SHELL_INTERLEAVE) i = ShellInsertAvx2(elem, n, incr);
+#endif
+	for (; i < n; i++)
+	{	// elem[i]
+		int e = elem[i];
+		int j;
+		for (j = i - incr; j >= 0 && e < elem[j]; j -= incr)
+		{	// 
+			elem[j + incr] = elem[j];
+		}
+		elem[j + incr] = e;
+	}
+}
+
+template <class ElemType, class Compare = LessCompare>
+void InterleavedShellSort(ElemType elem[], int n, Compare comp = Compare())
+// : ͬShellSort(elem, n, comp).һԪʱ֧Ԥ,
+//	,ֻintָ
+{
+	ShellSort(elem, n, comp);
+}
+
+inline void InterleavedShellSort(int elem[], int n, LessCompare = LessCompare())
+// : ShellGapsԶѡȡжelemShell,
+//	ShellInsertInterleavedͬʱеԪ
+{
+	int inc[SHELL_MAX_GAPS];
+	int t = ShellGaps(n, inc);
+	for (int k = 0; k < t; k++)
+	{	// kShell
+		ShellInsertInterleaved(elem, n, inc[k]);
 	}
 }
 
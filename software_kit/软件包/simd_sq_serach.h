@@ -0,0 +1,245 @@
+#ifndef __SIMD_SQ_SERACH_H__
+#define __SIMD_SQ_SERACH_H__
+
+#include "simd_support.h"				// SIMDָ֧
+#include "bin_serach.h"					// ۰
+
+#define SIMD_SEARCH_THRESHOLD 1024		// Ԫظֵʱ˳Ҵ۰
+
+// ˳: intfloatÿαȽ϶Ԫ,ʱ⴦,֧AVX2ʱÿ
+//	Ƚ8,SSE2ÿαȽ4,֧ʱȽ
+
+// ʵ
+template <class ElemType>
+int ScalarSqSerach(const ElemType elem[], int n, ElemType key)
+// : صһkeyԪص,ʱ-1
+{
+	for (int i = 0; i < n; i++)
+	{	// Ƚ
+		if (elem[i] == key) return i;
+	}
+	return -1;
+}
+
+template <class ElemType>
+int ScalarLowerBound(const ElemType elem[], int n, ElemType key)
+// ʼ: elem[0 .. n - 1]
+// : صһСkeyԪص,Сkeyʱn
+{
+	int i;
+	for (i = 0; i < n && elem[i] < key; i++);
+	return i;
+}
+
+#ifdef SIMD_SSE2
+// SSE2ʵ
+inline int Sse2SqSerach(const int elem[], int n, int key)
+// : صһkeyԪص,ʱ-1
+{
+	__m128i k = _mm_set1_epi32(key);
+	int i = 0;
+	for (; i + 4 <= n; i += 4)
+	{	// ÿαȽ4Ԫ
+		__m128i v = _mm_loadu_si128((const __m128i *)(elem + i));
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, k)));
+		if (mask != 0) return i + LowestBitIndex(mask);
+	}
+	int pos = ScalarSqSerach(elem + i, n - i, key);	// ʣԪ
+	return pos < 0 ? -1 : i + pos;
+}
+
+inline int Sse2SqSerach(const float elem[], int n, float key)
+// : صһkeyԪص,ʱ-1
+{
+	__m128 k = _mm_set1_ps(key);
+	int i = 0;
+	for (; i + 4 <= n; i += 4)
+	{	// ÿαȽ4Ԫ
+		int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(elem + i), k));
+		if (mask != 0) return i + LowestBitIndex(mask);
+	}
+	int pos = ScalarSqSerach(elem + i, n - i, key);	// ʣԪ
+	return pos < 0 ? -1 : i + pos;
+}
+
+inline int Sse2LowerBound(const int elem[], int n, int key)
+// ʼ: elem[0 .. n - 1]
+// : صһСkeyԪص,Сkeyʱn
+{
+	__m128i k = _mm_set1_epi32(key);
+	int i = 0;
+	for (; i + 4 <= n; i += 4)
+	{	// СkeyԪǰ׺,һСkeyԪڵ벻ȫΪ1
+		__m128i v = _mm_loadu_si128((const __m128i *)(elem + i));
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, k)));
+		if (mask != 0xF) return i + LowestBitIndex(~mask);
+	}
+	return i + ScalarLowerBound(elem + i, n - i, key);
+}
+
+inline int Sse2LowerBound(const float elem[], int n, float key)
+// ʼ: elem[0 .. n - 1]
+// : صһСkeyԪص,Сkeyʱn
+{
+	__m128 k = _mm_set1_ps(key);
+	int i = 0;
+	for (; i + 4 <= n; i += 4)
+	{	// ÿαȽ4Ԫ
+		int mask = _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(elem + i), k));
+		if (mask != 0xF) return i + LowestBitIndex(~mask);
+	}
+	return i + ScalarLowerBound(elem + i, n - i, key);
+}
+#endif
+
+#ifdef SIMD_AVX2_DISPATCH
+// AVX2ʵ
+SIMD_TARGET_AVX2 inline int Avx2SqSerach(const int elem[], int n, int key)
+// : صһkeyԪص,ʱ-1
+{
+	__m256i k = _mm256_set1_epi32(key);
+	int i = 0;
+	for (; i + 8 <= n; i += 8)
+	{	// ÿαȽ8Ԫ
+		__m256i v = _mm256_loadu_si256((const __m256i *)(elem + i));
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, k)));
+		if (mask != 0) return i + LowestBitIndex(mask);
+	}
+	int pos = ScalarSqSerach(elem + i, n - i, key);	// ʣԪ
+	return pos < 0 ? -1 : i + pos;
+}
+
+SIMD_TARGET_AVX2 inline int Avx2SqSerach(const float elem[], int n, float key)
+// : صһkeyԪص,ʱ-1
+{
+	__m256 k = _mm256_set1_ps(key);
+	int i = 0;
+	for (; i + 8 <= n; i += 8)
+	{	// ÿαȽ8Ԫ
+		int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(elem + i), k, _CMP_EQ_OQ));
+		if (mask != 0) return i + LowestBitIndex(mask);
+	}
+	int pos = ScalarSqSerach(elem + i, n - i, key);	// ʣԪ
+	return pos < 0 ? -1 : i + pos;
+}
+
+SIMD_TARGET_AVX2 inline int Avx2LowerBound(const int elem[], int n, int key)
+// ʼ: elem[0 .. n - 1]
+// : صһСkeyԪص,Сkeyʱn
+{
+	__m256i k = _mm256_set1_epi32(key);
+	int i = 0;
+	for (; i + 8 <= n; i += 8)
+	{	// ÿαȽ8Ԫ
+		__m256i v = _mm256_loadu_si256((const __m256i *)(elem + i));
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(k, v)));
+		if (mask != 0xFF) return i + LowestBitIndex(~mask);
+	}
+	return i + ScalarLowerBound(elem + i, n - i, key);
+}
+
+SIMD_TARGET_AVX2 inline int Avx2LowerBound(const float elem[], int n, float key)
+// ʼ: elem[0 .. n - 1]
+// : صһСkeyԪص,Сkeyʱn
+{
+	__m256 k = _mm256_set1_ps(key);
+	int i = 0;
+	for (; i + 8 <= n; i += 8)
+	{	// ÿαȽ8Ԫ
+		int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(elem + i), k, _CMP_LT_OQ));
+		if (mask != 0xFF) return i + LowestBitIndex(~mask);
+	}
+	return i + ScalarLowerBound(elem + i, n - i, key);
+}
+#endif
+
+// ʱ
+template <class ElemType>
+int SimdSqSerachHelp(const ElemType elem[], int n, ElemType key)
+// ʼ: ElemTypeΪintfloat
+// : ֵָ֧Ӧ˳
+{
+#ifdef SIMD_AVX2_DISPATCH
+	if (HasAvx2()) return Avx2SqSerach(elem, n, key);
+#endif
+#ifdef SIMD_SSE2
+	return Sse2SqSerach(elem, n, key);
+#else
+	return ScalarSqSerach(elem, n, key);
+#endif
+}
+
+template <class ElemType>
+int SimdLowerBoundHelp(const ElemType elem[], int n, ElemType key)
+// ʼ: ElemTypeΪintfloat, elem[0 .. n - 1]
+// : ֵָ֧Ӧλ
+{
+#ifdef SIMD_AVX2_DISPATCH
+	if (HasAvx2()) return Avx2LowerBound(elem, n, key);
+#endif
+#ifdef SIMD_SSE2
+	return Sse2LowerBound(elem, n, key);
+#else
+	return ScalarLowerBound(elem, n, key);
+#endif
+}
+
+template <class ElemType>
+int SimdSqSerach(const ElemType elem[], int n, ElemType key)
+// : ˳вҵһkeyԪ,ҳɹ,򷵻,򷵻-1.
+//	һԪȽ
+{
+	return ScalarSqSerach(elem, n, key);
+}
+
+inline int SimdSqSerach(const int elem[], int n, int key)
+// : int˳ָҵһkeyԪ,ҳɹ,򷵻,
+//	򷵻-1
+{
+	return SimdSqSerachHelp(elem, n, key);
+}
+
+inline int SimdSqSerach(const float elem[], int n, float key)
+// : float˳ָҵһkeyԪ,ҳɹ,򷵻,
+//	򷵻-1
+{
+	return SimdSqSerachHelp(elem, n, key);
+}
+
+template <class ElemType>
+int SimdLowerBound(const ElemType elem[], int n, ElemType key)
+// ʼ: elem[0 .. n - 1]
+// : صһСkeyԪص,Сkeyʱn.һԪȽ
+{
+	return ScalarLowerBound(elem, n, key);
+}
+
+inline int SimdLowerBound(const int elem[], int n, int key)
+// ʼ: elem[0 .. n - 1]
+// : ָһСkeyԪص,Сkeyʱn
+{
+	return SimdLowerBoundHelp(elem, n, key);
+}
+
+inline int SimdLowerBound(const float elem[], int n, float key)
+// ʼ: elem[0 .. n - 1]
+// : ָһСkeyԪص,Сkeyʱn
+{
+	return SimdLowerBoundHelp(elem, n, key);
+}
+
+template <class ElemType>
+int HybridSerach(const ElemType elem[], int n, ElemType key)
+// ʼ: elem[0 .. n - 1]
+// : ҹؼֵkeyԪ,ҳɹ,򷵻,򷵻-1.Ԫظ
+//	SIMD_SEARCH_THRESHOLDʱ˳,۰
+{
+	if (n <= SIMD_SEARCH_THRESHOLD)
+	{	// С˳ɨ
+		int pos = SimdLowerBound(elem, n, key);
+		return pos < n && elem[pos] == key ? pos : -1;
+	}
+	return BinSerach(elem, n, key);
+}
+
+#endif
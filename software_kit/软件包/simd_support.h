@@ -0,0 +1,76 @@
+#ifndef __SIMD_SUPPORT_H__
+#define __SIMD_SUPPORT_H__
+
+// SIMDָ֧
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2							// ֧SSE2ָ
+#include <emmintrin.h>						// SSE2ָ
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>							// VCڲ
+#endif
+
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) || \
+	(defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define SIMD_AVX2_DISPATCH					// ʱⲢʹAVX2ָ
+#include <immintrin.h>						// AVX2ָ
+#endif
+
+// ʹAVX2ָĺӴ˱,԰Ĭָ
+#if defined(SIMD_AVX2_DISPATCH) && defined(__GNUC__)
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMD_TARGET_AVX2
+#endif
+
+#define CACHE_LINE_SIZE 64					// ֽ
+
+// Ԥȡ: ǰaddrڵĻе뻺
+#if defined(_MSC_VER) && defined(SIMD_SSE2)
+#define PREFETCH(addr) _mm_prefetch((const char *)(addr), _MM_HINT_T0)
+#elif defined(__GNUC__)
+#define PREFETCH(addr) __builtin_prefetch((const void *)(addr))
+#else
+#define PREFETCH(addr) ((void)0)
+#endif
+
+inline int LowestBitIndex(unsigned int mask)
+// ʼ: mask0
+// : mask͵1λ
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (int)index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+inline bool CpuSupportsAvx2()
+// : ǰϵͳ֧AVX2ָʱtrue,򷵻false
+{
+#if defined(SIMD_AVX2_DISPATCH) && defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 1);
+	if ((regs[2] & (1 << 27)) == 0) return false;	// ϵͳδXSAVE
+	if ((_xgetbv(0) & 6) != 6) return false;		// ϵͳYMMĴ
+	__cpuidex(regs, 7, 0);
+	return (regs[1] & (1 << 5)) != 0;				// AVX2־
+#elif defined(SIMD_AVX2_DISPATCH)
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+inline bool HasAvx2()
+// : ǰ֧AVX2ָʱtrue,ֻڵһεʱ,ɺʹ
+{
+	static const bool avx2 = CpuSupportsAvx2();	// ֻһ
+	return avx2;
+}
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef __SIMPLE_MERGE_SORT_H__
 #define __SIMPLE_MERGE_SORT_H__
 
-template <class ElemType>
-void SimpleMerge(ElemType elem[], int low, int mid, int high)
+#include "sort_compare.h"			// ȽϺ
+
+template <class ElemType, class Compare = LessCompare>
+void SimpleMerge(ElemType elem[], int low, int mid, int high, Compare comp = Compare())
 // :elem[low .. mid]elem[mid + 1 .. midhigh]鲢Ϊµ
 //	elem[low .. high]
 {
@@ -12,7 +14,7 @@ void SimpleMerge(ElemType elem[], int low, int mid, int high)
 	for (i = low, j = mid + 1, k = low; i <= mid && j <= high; k++)
 	{	// iΪ鲢ʱelem[low .. mid]ǰԪص±,jΪ鲢ʱelem[mid + 1 .. high]ǰԪ
 		// ±,kΪtmpElemеǰԪص±
-		if (elem[i] <= elem[j])
+		if (!comp(elem[j], elem[i]))
 		{	// elem[i]С,ȹ鲢
 			tmpElem[k] = elem[i];
 			i++;
@@ -42,25 +44,25 @@ void SimpleMerge(ElemType elem[], int low, int mid, int high)
 	delete []tmpElem;		// ͷtmpElemÿռ
 }
 
-template <class ElemType>
-void SimpleMergeSortHelp(ElemType elem[], int low, int high)
+template <class ElemType, class Compare = LessCompare>
+void SimpleMergeSortHelp(ElemType elem[], int low, int high, Compare comp = Compare())
 // :elem[low .. high]м򵥹鲢
 {
 	if (low < high)
 	{	
 		int mid = (low + high) / 2;			
 			// elem[low .. high]ƽΪelem[low .. mid]elem[mid + 1 .. high]
-		SimpleMergeSortHelp(elem, low, mid);		// elem[low .. mid]м򵥹鲢
-		SimpleMergeSortHelp(elem, mid + 1, high);	// elem[mid + 1 .. high]м򵥹鲢
-		SimpleMerge(elem, low, mid, high);			// elem[low .. mid]elem[mid + 1 .. high]й鲢
+		SimpleMergeSortHelp(elem, low, mid, comp);	// elem[low .. mid]м򵥹鲢
+		SimpleMergeSortHelp(elem, mid + 1, high, comp);	// elem[mid + 1 .. high]м򵥹鲢
+		SimpleMerge(elem, low, mid, high, comp);	// elem[low .. mid]elem[mid + 1 .. high]й鲢
 	}
 }
 
-template <class ElemType>
-void SimpleMergeSort(ElemType elem[], int n)
-// :elemм򵥹鲢
+template <class ElemType, class Compare = LessCompare>
+void SimpleMergeSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemм򵥹鲢
 {
-	SimpleMergeSortHelp(elem, 0, n - 1);
+	SimpleMergeSortHelp(elem, 0, n - 1, comp);
 }
 
 #endif
@@ -2,17 +2,18 @@
 #define __SIMPLE_SELECT_SORT_H__
 
 #include "utility.h"				// ʵó
+#include "sort_compare.h"			// ȽϺ
 
-template <class ElemType>
-void SimpleSelectionSort(ElemType elem[], int n)
-// :elemѡ
+template <class ElemType, class Compare = LessCompare>
+void SimpleSelectionSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemѡ
 {
 	for ( int i = 0; i < n - 1; i++)
 	{	// i˼ѡ
 		int lowIndex = i;			// ¼elem[i .. n - 1]СԪС
 		for (int j = i + 1; j < n; j++)
 		{
-			if (elem[j] < elem[lowIndex])
+			if (comp(elem[j], elem[lowIndex]))
 			{	// lowIndexd洢ǰѰСԪС
 				lowIndex = j;
 			}
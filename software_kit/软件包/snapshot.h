@@ -0,0 +1,93 @@
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include "utility.h"						// ʵó
+#include <type_traits>						// is_trivially_copyable
+
+#define SNAPSHOT_VERSION 1					// ոʽ汾
+#define SNAPSHOT_MAX_SECTIONS 4				// 
+#define SNAPSHOT_ALIGN 64					// ļеĶֽ
+
+// бݽṹ
+enum SnapshotKind {SNAPSHOT_HASH_TABLE = 1, SNAPSHOT_SQ_LIST = 2};
+
+// ļʽд: Saveֻͷļ,ֻļд;ӳļ
+//	SnapshotFilesnapshot_file.h,ͷļڴӳϵͳͷļ
+
+// ļͷ: ļļͷSNAPSHOT_MAX_SECTIONSSNAPSHOT_ALIGNֽڶ,
+//	鲼ڴͬ,ӳֱʹ
+struct SnapshotHeader
+{
+	char magic[8];							// ļʶ"DSSNAP"
+	int version;							// ոʽ汾
+	int kind;								// ݽṹ
+	int elemSize;							// Ԫصֽ
+	int sectionCount;						// 
+	long long param[4];						// ݽṹĲ,,Ԫظ
+	long long offset[SNAPSHOT_MAX_SECTIONS];// ļеλ
+	long long length[SNAPSHOT_MAX_SECTIONS];// ֽ
+	unsigned long long checksum[SNAPSHOT_MAX_SECTIONS];	// У
+	unsigned long long headerChecksum;		// ϸУ
+};
+
+// غ
+inline unsigned long long SnapshotChecksum(const void *data, long long len);
+	// data[0 .. len - 1]У
+inline void InitSnapshotHeader(SnapshotHeader &header, SnapshotKind kind, int elemSize);
+	// ʼļͷ
+inline bool SaveSnapshot(const char *fileName, SnapshotHeader &header, const void *section[]);
+	// ļͷдļ
+
+// غʵֲ
+inline unsigned long long SnapshotChecksum(const void *data, long long len)
+// : data[0 .. len - 1]FNV-1aУ
+{
+	const unsigned char *p = (const unsigned char *)data;
+	unsigned long long sum = 0xcbf29ce484222325ULL;
+	for (long long i = 0; i < len; i++)
+	{	// ֽۼ
+		sum = (sum ^ p[i]) * 0x100000001b3ULL;
+	}
+	return sum;
+}
+
+inline void InitSnapshotHeader(SnapshotHeader &header, SnapshotKind kind, int elemSize)
+// : ʼļͷ,ĳȴд
+{
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "DSSNAP", 6);
+	header.version = SNAPSHOT_VERSION;
+	header.kind = kind;
+	header.elemSize = elemSize;
+}
+
+inline bool SaveSnapshot(const char *fileName, SnapshotHeader &header, const void *section[])
+// ʼ: headerдsectionCount, paramlength
+// : λУ,ļͷsection[0 .. sectionCount - 1]д
+//	ļfileName,ɹtrue,򷵻false
+{
+	long long pos = sizeof(SnapshotHeader);
+	for (int i = 0; i < header.sectionCount; i++)
+	{	// 鰴SNAPSHOT_ALIGNֽڶ
+		pos = (pos + SNAPSHOT_ALIGN - 1) / SNAPSHOT_ALIGN * SNAPSHOT_ALIGN;
+		header.offset[i] = pos;
+		header.checksum[i] = SnapshotChecksum(section[i], header.length[i]);
+		pos += header.length[i];
+	}
+	header.headerChecksum = SnapshotChecksum(&header, (char *)&header.headerChecksum - (char *)&header);
+
+	ofstream outFile(fileName, ios::binary);// ļ
+	if (!outFile) return false;
+	char zero[SNAPSHOT_ALIGN] = {0};		// 
+	outFile.write((const char *)&header, sizeof(header));
+	pos = sizeof(SnapshotHeader);
+	for (int i = 0; i < header.sectionCount; i++)
+	{	// дi
+		outFile.write(zero, header.offset[i] - pos);
+		outFile.write((const char *)section[i], header.length[i]);
+		pos = header.offset[i] + header.length[i];
+	}
+	return (bool)outFile;
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef __SNAPSHOT_FILE_H__
+#define __SNAPSHOT_FILE_H__
+
+#include "snapshot.h"						// ļʽ
+#include "mapped_file.h"					// ڴӳļ
+
+// ӳĿļ
+class SnapshotFile
+{
+protected:
+//  ļݳԱ:
+	MappedFile file;						// ӳļ
+	const SnapshotHeader *header;			// ļͷ
+
+public:
+//  :
+	SnapshotFile();							// 캯
+	bool Open(const char *fileName, SnapshotKind kind, int elemSize, bool verify = false);
+		// ӳ䲢ļ
+	void Close();							// ӳ
+	const SnapshotHeader *Header() const;	// ļͷ
+	const char *Section(int i) const;		// صiʼַ
+};
+
+// ļʵֲ
+inline SnapshotFile::SnapshotFile()
+// : δӳκļĶ
+{
+	header = NULL;
+}
+
+inline bool SnapshotFile::Open(const char *fileName, SnapshotKind kind, int elemSize, bool verify)
+// : ֻʽӳļfileName,ļʶ,汾,,ԪشСļͷ
+//	У,verifyΪtrueʱУ,ҳ״ηʱŵ.ɹ
+//	true,򷵻false
+{
+	Close();
+	if (!file.Open(fileName) || file.Size() < (long long)sizeof(SnapshotHeader)) return false;
+
+	const SnapshotHeader *h = (const SnapshotHeader *)file.Data();
+	bool valid = memcmp(h->magic, "DSSNAP", 6) == 0 && h->version == SNAPSHOT_VERSION &&
+		h->kind == kind && h->elemSize == elemSize &&
+		h->sectionCount >= 0 && h->sectionCount <= SNAPSHOT_MAX_SECTIONS &&
+		h->headerChecksum == SnapshotChecksum(h, (const char *)&h->headerChecksum - (const char *)h);
+	for (int i = 0; valid && i < h->sectionCount; i++)
+	{	// i
+		valid = h->offset[i] >= 0 && h->length[i] >= 0 && h->offset[i] <= file.Size() &&
+			h->length[i] <= file.Size() - h->offset[i];
+		if (valid && verify)
+		{	// У
+			valid = SnapshotChecksum(file.Data() + h->offset[i], h->length[i]) == h->checksum[i];
+		}
+	}
+	if (!valid)
+	{	// ļ
+		file.Close();
+		return false;
+	}
+	header = h;
+	return true;
+}
+
+inline void SnapshotFile::Close()
+// : ӳ
+{
+	file.Close();
+	header = NULL;
+}
+
+inline const SnapshotHeader *SnapshotFile::Header() const
+// : ļͷ
+{
+	return header;
+}
+
+inline const char *SnapshotFile::Section(int i) const
+// : صiʼַ
+{
+	return file.Data() + header->offset[i];
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef __SORT_COMPARE_H__
+#define __SORT_COMPARE_H__
+
+// ȽϺ: ģһcompΪȽϺ, comp(a, b)Ϊtrueʾa
+//	Ӧb֮ǰ,<һϸ(<=).ʡʱLessCompare,<;¼
+//	ĳؼʱ,ByKeyɹؼͶӰȽϺ
+
+// ȱʡȽϺ: <Ƚ
+struct LessCompare
+{
+	template <class FirstType, class SecondType>
+	bool operator()(const FirstType &a, const SecondType &b) const
+	// : a < b
+	{
+		return a < b;
+	}
+};
+
+// ȽϺ: ڵݼ,Ԫֻ趨<
+struct GreaterCompare
+{
+	template <class FirstType, class SecondType>
+	bool operator()(const FirstType &a, const SecondType &b) const
+	// : b < a
+	{
+		return b < a;
+	}
+};
+
+// ؼֱȽϺģ: key(e)ԪeĹؼ,compȽԪصĹؼ.ÿαȽ
+//	key,ؼӦ۵,緵ؼ¼ĳԱ
+template <class KeyFunc, class Compare = LessCompare>
+class KeyCompare
+{
+protected:
+//  ؼֱȽϵݳԱ:
+	KeyFunc key;								// ؼͶӰ
+	Compare comp;								// ؼֵıȽϺ
+
+public:
+//  :
+	KeyCompare(KeyFunc k, Compare c = Compare()): key(k), comp(c) {}	// 캯ģ
+	template <class FirstType, class SecondType>
+	bool operator()(const FirstType &a, const SecondType &b) const	// ȽabĹؼ
+	{
+		return comp(key(a), key(b));
+	}
+};
+
+template <class KeyFunc>
+KeyCompare<KeyFunc> ByKey(KeyFunc key)
+// : ذؼkey(e)ıȽϺ
+{
+	return KeyCompare<KeyFunc>(key);
+}
+
+template <class KeyFunc, class Compare>
+KeyCompare<KeyFunc, Compare> ByKey(KeyFunc key, Compare comp)
+// : compȽϹؼkey(e)ıȽϺ
+{
+	return KeyCompare<KeyFunc, Compare>(key, comp);
+}
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef __SORTING_NETWORK_H__
+#define __SORTING_NETWORK_H__
+
+#include "utility.h"				// ʵó
+#include "simd_support.h"			// SIMDָ֧
+#include "straight_insert_sort.h"	// ֱӲ
+
+#define NETWORK_SORT_MAX 64			// һοԪظ
+#define NETWORK_SORT_THRESHOLD 32	// 鲢гȲֵ
+
+// : AVX2ָʵ˫,һĴ8int.ڼĴ,
+//	˫鲢Ĵ鲢,8, 16, 32, 64Ԫ.floatλģʽתint
+//	Ƚ븡ͬ,ʹint.8, 16, 32, 64ʱֵ.֧
+//	AVX2ԪͲintfloatʱֱӲ
+
+#ifdef SIMD_AVX2_DISPATCH
+template <int Mask>
+SIMD_TARGET_AVX2 inline __m256i NetCompareLanes(__m256i v, __m256i p)
+// : vpȽ,MaskΪ1ĵȡϴ,Ϊ0ĵȡС
+{
+	return _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), Mask);
+}
+
+SIMD_TARGET_AVX2 inline __m256i NetMerge8(__m256i v)
+// ʼ: v8Ԫع˫
+// : αȽ4, 2, 1ĵ,صļĴ
+{
+	v = NetCompareLanes<0xF0>(v, _mm256_permute2x128_si256(v, v, 1));
+	v = NetCompareLanes<0xCC>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = NetCompareLanes<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return v;
+}
+
+SIMD_TARGET_AVX2 inline __m256i NetSort8(__m256i v)
+// : ؼĴ8ԪصļĴ
+{
+	v = NetCompareLanes<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));	// 
+	v = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 1, 0));	// תÿĺһ,Ϊ˫
+	v = NetCompareLanes<0xCC>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = NetCompareLanes<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));	// ÿ4
+	v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 3, 7, 6, 5, 4));	// ת4
+	return NetMerge8(v);
+}
+
+SIMD_TARGET_AVX2 inline void NetMergeRuns(__m256i v[], int cnt)
+// ʼ: v[0 .. cnt / 2 - 1]v[cnt / 2 .. cnt - 1]ֱǵ, cntΪ2
+// : ˫鲢Ϊv[0 .. cnt - 1]
+{
+	const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	int half = cnt / 2;
+	for (int i = 0; i < half / 2; i++)
+	{	// һĴ
+		__m256i t = v[half + i];
+		v[half + i] = v[cnt - 1 - i];
+		v[cnt - 1 - i] = t;
+	}
+	for (int i = half; i < cnt; i++)
+	{	// Ĵ,гΪ˫
+		v[i] = _mm256_permutevar8x32_epi32(v[i], reverse);
+	}
+	for (int dist = half; dist >= 1; dist /= 2)
+	{	// ȽdistĴԪ
+		for (int i = 0; i < cnt; i++)
+		{	// СǰļĴ
+			if ((i & dist) != 0) continue;
+			__m256i lo = _mm256_min_epi32(v[i], v[i + dist]);
+			v[i + dist] = _mm256_max_epi32(v[i], v[i + dist]);
+			v[i] = lo;
+		}
+	}
+	for (int i = 0; i < cnt; i++)
+	{	// Ĵڹ鲢
+		v[i] = NetMerge8(v[i]);
+	}
+}
+
+SIMD_TARGET_AVX2 inline void NetSortBits(int buf[], int cnt, bool isFloat)
+// ʼ: buf8 * cntԪ, cntΪ1, 2, 48, isFloatΪtrueʱԪΪfloatλģʽ
+// : 罫bufųɵ
+{
+	__m256i v[NETWORK_SORT_MAX / 8];
+	const __m256i low31 = _mm256_set1_epi32(0x7FFFFFFF);
+	for (int i = 0; i < cnt; i++)
+	{	// 벢Ĵ
+		v[i] = _mm256_loadu_si256((const __m256i *)(buf + 8 * i));
+		if (isFloat)
+		{	// ת31λ,ʹintȽ븡ͬ
+			v[i] = _mm256_xor_si256(v[i], _mm256_and_si256(_mm256_srai_epi32(v[i], 31), low31));
+		}
+		v[i] = NetSort8(v[i]);
+	}
+	for (int run = 1; run < cnt; run *= 2)
+	{	// Ϊrun鲢
+		for (int start = 0; start < cnt; start += 2 * run) NetMergeRuns(v + start, 2 * run);
+	}
+	for (int i = 0; i < cnt; i++)
+	{	// д,תǶԺ,һμָԭλģʽ
+		if (isFloat) v[i] = _mm256_xor_si256(v[i], _mm256_and_si256(_mm256_srai_epi32(v[i], 31), low31));
+		_mm256_storeu_si256((__m256i *)(buf + 8 * i), v[i]);
+	}
+}
+
+SIMD_TARGET_AVX2 inline void NetMergeBits(int buf[], int cnt, bool isFloat)
+// ʼ: buf8 * cntԪصǰֱ, cntΪ2, 48
+// : ˫鲢罫buf鲢Ϊ
+{
+	__m256i v[NETWORK_SORT_MAX / 8];
+	const __m256i low31 = _mm256_set1_epi32(0x7FFFFFFF);
+	for (int i = 0; i < cnt; i++)
+	{	// 
+		v[i] = _mm256_loadu_si256((const __m256i *)(buf + 8 * i));
+		if (isFloat) v[i] = _mm256_xor_si256(v[i], _mm256_and_si256(_mm256_srai_epi32(v[i], 31), low31));
+	}
+	NetMergeRuns(v, cnt);
+	for (int i = 0; i < cnt; i++)
+	{	// д
+		if (isFloat) v[i] = _mm256_xor_si256(v[i], _mm256_and_si256(_mm256_srai_epi32(v[i], 31), low31));
+		_mm256_storeu_si256((__m256i *)(buf + 8 * i), v[i]);
+	}
+}
+#endif
+
+inline int NetworkRegisterCount(int n)
+// : nԪصļĴ1, 2, 48
+{
+	int cnt = 1;
+	while (8 * cnt < n) cnt *= 2;
+	return cnt;
+}
+
+template <class ElemType>
+bool NetworkSortHelp(ElemType elem[], int n, bool isFloat)
+// ʼ: ElemTypeΪintfloat
+// : ֧AVX2nNETWORK_SORT_MAXʱelemtrue,
+//	򷵻false
+{
+#ifdef SIMD_AVX2_DISPATCH
+	if (HasAvx2() && n > 1 && n <= NETWORK_SORT_MAX)
+	{	// Ƶ,ֵ
+		int buf[NETWORK_SORT_MAX];
+		int cnt = NetworkRegisterCount(n);
+		memcpy(buf, elem, n * sizeof(int));
+		for (int i = n; i < 8 * cnt; i++) buf[i] = 0x7FFFFFFF;	// floatΪNaN,ֻ
+		NetSortBits(buf, cnt, isFloat);
+		memcpy(elem, buf, n * sizeof(int));
+		return true;
+	}
+#endif
+	(void)isFloat;
+	return false;
+}
+
+template <class ElemType>
+bool BitonicMergeHelp(ElemType elem[], int n, bool isFloat)
+// ʼ: ElemTypeΪintfloat
+// : ֧AVX2nΪ16, 3264ʱ˫鲢鲢elemǰ벢
+//	true,򷵻false
+{
+#ifdef SIMD_AVX2_DISPATCH
+	if (HasAvx2() && (n == 16 || n == 32 || n == 64))
+	{	// 鲢
+		NetMergeBits((int *)elem, n / 8, isFloat);
+		return true;
+	}
+#endif
+	(void)isFloat;
+	return false;
+}
+
+template <class ElemType, class Compare = LessCompare>
+void NetworkSort(ElemType elem[], int n, Compare comp = Compare())
+// : ȽϺcompelem[0 .. n - 1].һԪͻȽϺֱ
+//	
+{
+	StraightInsertSort(elem, n, comp);
+}
+
+inline void NetworkSort(int elem[], int n, LessCompare = LessCompare())
+// : nNETWORK_SORT_MAXҴ֧AVX2ʱelem,ֱ
+//	
+{
+	if (!NetworkSortHelp(elem, n, false)) StraightInsertSort(elem, n);
+}
+
+inline void NetworkSort(float elem[], int n, LessCompare = LessCompare())
+// : nNETWORK_SORT_MAXҴ֧AVX2ʱelem,ֱ
+//	
+{
+	if (!NetworkSortHelp(elem, n, true)) StraightInsertSort(elem, n);
+}
+
+template <class ElemType>
+void BitonicMerge(ElemType elem[], int n)
+// ʼ: elem[0 .. n / 2 - 1]elem[n / 2 .. n - 1]ֱ
+// : 鲢Ϊelem[0 .. n - 1].һԪֱӲ,һ
+{
+	StraightInsertSort(elem, n);
+}
+
+inline void BitonicMerge(int elem[], int n)
+// ʼ: elem[0 .. n / 2 - 1]elem[n / 2 .. n - 1]ֱ
+// : nΪ16, 3264Ҵ֧AVX2ʱ˫鲢鲢,ֱӲ
+{
+	if (!BitonicMergeHelp(elem, n, false)) StraightInsertSort(elem, n);
+}
+
+inline void BitonicMerge(float elem[], int n)
+// ʼ: elem[0 .. n / 2 - 1]elem[n / 2 .. n - 1]ֱ
+// : nΪ16, 3264Ҵ֧AVX2ʱ˫鲢鲢,ֱӲ
+{
+	if (!BitonicMergeHelp(elem, n, true)) StraightInsertSort(elem, n);
+}
+
+#endif
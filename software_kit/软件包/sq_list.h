@@ -2,6 +2,7 @@
 #define __SQ_LIST_H__
 
 #include "utility.h"			// ʵó
+#include "snapshot.h"			// ļ
 
 // ˳ģ
 template <class ElemType>
@@ -29,6 +30,7 @@ public:
 	StatusCode SetElem(int position, const ElemType &e);	// ָλõԪֵ
 	StatusCode Delete(int position, ElemType &e);// ɾԪ		
 	StatusCode Insert(int position, const ElemType &e); // Ԫ
+	bool Save(const char *fileName) const;	// Աдļ
 	SqList(const SqList<ElemType> &copy); // ƹ캯ģ
 	SqList<ElemType> &operator =(const SqList<ElemType> &copy); // ظֵ
 };
@@ -188,6 +190,23 @@ StatusCode SqList<ElemType>::Insert(int position, const ElemType &e)
 	}
 }
 
+template <class ElemType>
+bool SqList<ElemType>::Save(const char *fileName) const
+// ԱдļfileName,SqListViewӳֱӷ,
+//	ɹtrue,򷵻false
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "Ԫɰֽڸ");
+
+	SnapshotHeader header;				// ļͷ
+	InitSnapshotHeader(header, SNAPSHOT_SQ_LIST, (int)sizeof(ElemType));
+	header.param[0] = count;			// Ԫظ
+	header.param[1] = maxSize;			// Ԫظ
+	header.sectionCount = 1;
+	header.length[0] = (long long)count * sizeof(ElemType);
+	const void *section[1] = {elems};	// Ԫش洢ռ
+	return SaveSnapshot(fileName, header, section);
+}
+
 template <class ElemType>
 SqList<ElemType>::SqList(const SqList<ElemType> &copy)
 // ԱcopyԱƹ캯ģ
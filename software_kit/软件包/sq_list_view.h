@@ -0,0 +1,115 @@
+#ifndef __SQ_LIST_VIEW_H__
+#define __SQ_LIST_VIEW_H__
+
+#include "snapshot_file.h"					// ӳĿļ
+
+// ˳ͼģ: ӳSqList::SaveдĿļ,ֱӶȡӳеԪ
+template <class ElemType>
+class SqListView
+{
+protected:
+// ˳ͼݳԱ:
+	SnapshotFile file;					// ӳĿļ
+	const ElemType *elems;				// Ԫش洢ռ
+	int count;							// Ԫظ
+
+public:
+// ˳ͼ:
+	SqListView();						// 캯ģ
+	bool Open(const char *fileName, bool verify = false);	// ӳļ
+	void Close();						// ӳ
+	int Length() const;					// Ա			 
+	bool Empty() const;					// жԱǷΪ
+	void Traverse(void (*visit)(const ElemType &)) const;	// Ա
+	StatusCode GetElem(int position, ElemType &e) const;	// ָλõԪ	
+	const ElemType *Elems() const;		// Ԫ,BinSerachֱʹ
+};
+
+// ˳ͼģʵֲ
+template <class ElemType>
+SqListView<ElemType>::SqListView()
+// δӳκļͼ
+{
+	elems = NULL;
+	count = 0;
+}
+
+template <class ElemType>
+bool SqListView<ElemType>::Open(const char *fileName, bool verify)
+// ӳļfileName,ɹtrue,ļڻԪͬ˳
+//	ʱfalse.verifyΪtrueʱȫݵУ
+{
+	static_assert(is_trivially_copyable<ElemType>::value, "Ԫɰֽڸ");
+
+	Close();
+	if (!file.Open(fileName, SNAPSHOT_SQ_LIST, (int)sizeof(ElemType), verify)) return false;
+	const SnapshotHeader *header = file.Header();
+	if (header->sectionCount != 1 ||
+		header->param[0] < 0 || header->param[0] > numeric_limits<int>::max() ||
+		header->length[0] != header->param[0] * (long long)sizeof(ElemType))
+	{	// 鳤Ԫظ
+		file.Close();
+		return false;
+	}
+	count = (int)header->param[0];		// Ԫظ
+	elems = (const ElemType *)file.Section(0);
+	return true;
+}
+
+template <class ElemType>
+void SqListView<ElemType>::Close()
+// ӳ
+{
+	file.Close();
+	elems = NULL;
+	count = 0;
+}
+
+template <class ElemType>
+int SqListView<ElemType>::Length() const
+// ԱԪظ
+{
+	return count;
+}
+
+template <class ElemType>
+bool SqListView<ElemType>::Empty() const
+// ԱΪգ򷵻true򷵻false
+{
+	return count == 0;
+}
+
+template <class ElemType>
+void SqListView<ElemType>::Traverse(void (*visit)(const ElemType &)) const
+// ζԱÿԪصú(*visit)
+{
+	for (int curPosition = 1; curPosition <= Length(); curPosition++)
+	{	// ԱÿԪصú(*visit)
+		(*visit)(elems[curPosition - 1]);
+	}
+}
+
+template <class ElemType>
+StatusCode SqListView<ElemType>::GetElem(int position, ElemType &e) const
+// ԱڵpositionԪʱeֵENTRY_FOUND,
+//	򷵻NOT_PRESENT
+{
+	if(position < 1 || position > Length())
+	{	// positionΧ
+		return NOT_PRESENT;	// Ԫز
+	}
+	else
+	{	// positionϷ
+		e = elems[position - 1];
+		return ENTRY_FOUND;	// Ԫش
+	}
+}
+
+template <class ElemType>
+const ElemType *SqListView<ElemType>::Elems() const
+// Ԫ
+{
+	return elems;
+}
+
+#endif
@@ -0,0 +1,218 @@
+#ifndef __STATIC_BPLUS_TREE_H__
+#define __STATIC_BPLUS_TREE_H__
+
+#include "utility.h"							// ʵó
+#include "simd_support.h"						// SIMDָ֧
+
+#define STREE_NODE_KEYS 16						// ÿĹؼָ,intʱǡΪһ
+#define STREE_FANOUT (STREE_NODE_KEYS + 1)		// ڲĺӸ
+
+// ڼ
+template <class ElemType>
+int STreeCountLess(const ElemType node[], const ElemType &key)
+// ʼ: node[0 .. STREE_NODE_KEYS - 1]
+// : ؽСkeyĹؼָ
+{
+	int i;
+	for (i = 0; i < STREE_NODE_KEYS && node[i] < key; i++);
+	return i;
+}
+
+template <class ElemType>
+int STreeCountNotGreater(const ElemType node[], const ElemType &key)
+// ʼ: node[0 .. STREE_NODE_KEYS - 1]
+// : ؽвkeyĹؼָ
+{
+	int i;
+	for (i = 0; i < STREE_NODE_KEYS && node[i] <= key; i++);
+	return i;
+}
+
+#ifdef SIMD_SSE2
+inline int STreeCountLess(const int node[], const int &key)
+// ʼ: node[0 .. STREE_NODE_KEYS - 1]Ұж
+// : SSE2һαȽϽ16ؼ,СkeyĹؼָ
+{
+	__m128i k = _mm_set1_epi32(key);
+	const __m128i *p = (const __m128i *)node;
+	__m128i c01 = _mm_packs_epi32(_mm_cmpgt_epi32(k, _mm_load_si128(p)),
+		_mm_cmpgt_epi32(k, _mm_load_si128(p + 1)));
+	__m128i c23 = _mm_packs_epi32(_mm_cmpgt_epi32(k, _mm_load_si128(p + 2)),
+		_mm_cmpgt_epi32(k, _mm_load_si128(p + 3)));
+	unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(c01, c23));
+	return LowestBitIndex(~mask);				// СkeyĹؼǰ׺
+}
+
+inline int STreeCountNotGreater(const int node[], const int &key)
+// ʼ: node[0 .. STREE_NODE_KEYS - 1]Ұж
+// : SSE2һαȽϽ16ؼ,زkeyĹؼָ
+{
+	__m128i k = _mm_set1_epi32(key);
+	const __m128i *p = (const __m128i *)node;
+	__m128i c01 = _mm_packs_epi32(_mm_cmpgt_epi32(_mm_load_si128(p), k),
+		_mm_cmpgt_epi32(_mm_load_si128(p + 1), k));
+	__m128i c23 = _mm_packs_epi32(_mm_cmpgt_epi32(_mm_load_si128(p + 2), k),
+		_mm_cmpgt_epi32(_mm_load_si128(p + 3), k));
+	unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(c01, c23));
+	return mask == 0 ? STREE_NODE_KEYS : LowestBitIndex(mask);	// һkeyλ
+}
+#endif
+
+// ̬B+ģ: ΪҶ,ÿҶSTREE_NODE_KEYSԪ;ڲ
+//	STREE_NODE_KEYSؼֺSTREE_FANOUT,iؼΪi + 1СԪ.
+//	,λɽżó,ָ.ֻ,ʱΪO(n)
+template <class ElemType>
+class StaticBPlusTree
+{
+protected:
+//  ̬B+ݳԱ:
+	ElemType *storage;							// Ĵ洢ռ
+	ElemType *keys;								// Ĺؼ,ж
+	int layerOffset[32];						// keysеʼλ,0ΪҶ
+	int layerNodes[32];							// 
+	int height;									// 
+	int n;										// Ԫظ
+
+//	ģ:
+	template <class CountFunc>
+	int Descend(const ElemType &key, CountFunc count) const;	// Ը¶λ
+
+public:
+//  ̬B+:
+	StaticBPlusTree(const ElemType elem[], int cnt);	// elem[0 .. cnt - 1]
+	~StaticBPlusTree();							// ģ
+	int Length() const;							// Ԫظ
+	const ElemType &GetElem(int i) const;		// ĵiԪ(0ʼ)
+	int LowerBound(const ElemType &key) const;	// һСkeyԪص
+	int UpperBound(const ElemType &key) const;	// һkeyԪص
+	int Search(const ElemType &key) const;		// ҵkeyԪص
+	void Range(const ElemType &low, const ElemType &high,
+		void (*visit)(const ElemType &)) const;	// η[low, high]еԪ
+
+private:
+	StaticBPlusTree(const StaticBPlusTree<ElemType> &copy);	// ֹ
+	StaticBPlusTree<ElemType> &operator=(const StaticBPlusTree<ElemType> &copy);	// ֵֹ
+};
+
+// ̬B+ģʵֲ
+template <class ElemType>
+StaticBPlusTree<ElemType>::StaticBPlusTree(const ElemType elem[], int cnt)
+// : elem[0 .. cnt - 1]쾲̬B+,λElemTypeֵ
+{
+	const ElemType maxKey = numeric_limits<ElemType>::max();	// ֵ
+	int perLine = CACHE_LINE_SIZE / sizeof(ElemType) > 0 ? CACHE_LINE_SIZE / sizeof(ElemType) : 1;
+	n = cnt;
+	layerNodes[0] = (n + STREE_NODE_KEYS - 1) / STREE_NODE_KEYS;
+	if (layerNodes[0] == 0) layerNodes[0] = 1;
+	layerOffset[0] = 0;
+	height = 1;
+	while (layerNodes[height - 1] > 1)
+	{	// ,ֱֻһ
+		layerNodes[height] = (layerNodes[height - 1] + STREE_FANOUT - 1) / STREE_FANOUT;
+		layerOffset[height] = layerOffset[height - 1] + layerNodes[height - 1] * STREE_NODE_KEYS;
+		height++;
+	}
+	int total = layerOffset[height - 1] + layerNodes[height - 1] * STREE_NODE_KEYS;
+
+	storage = new ElemType[total + perLine];	// һڶ
+	keys = storage;
+	while ((size_t)keys % CACHE_LINE_SIZE != 0 && keys < storage + perLine)
+	{	// ʹÿλڻб߽
+		keys++;
+	}
+
+	for (int i = 0; i < layerNodes[0] * STREE_NODE_KEYS; i++)
+	{	// ҶΪ
+		keys[i] = i < n ? elem[i] : maxKey;
+	}
+	long long leavesPerChild = 1;				// h - 1ÿҶ
+	for (int h = 1; h < height; h++)
+	{	// h
+		for (int k = 0; k < layerNodes[h]; k++)
+		{	// hĵk
+			for (int i = 0; i < STREE_NODE_KEYS; i++)
+			{	// ؼΪi + 1ҶĵһԪ
+				long long child = (long long)k * STREE_FANOUT + i + 1;
+				long long first = child * leavesPerChild * STREE_NODE_KEYS;
+				keys[layerOffset[h] + k * STREE_NODE_KEYS + i] = first < n ? elem[first] : maxKey;
+			}
+		}
+		leavesPerChild *= STREE_FANOUT;
+	}
+}
+
+template <class ElemType>
+StaticBPlusTree<ElemType>::~StaticBPlusTree()
+// : پ̬B+
+{
+	delete []storage;
+}
+
+template <class ElemType>
+int StaticBPlusTree<ElemType>::Length() const
+// : Ԫظ
+{
+	return n;
+}
+
+template <class ElemType>
+const ElemType &StaticBPlusTree<ElemType>::GetElem(int i) const
+// : ĵiԪ(0ʼ)
+{
+	return keys[i];
+}
+
+template <class ElemType>
+template <class CountFunc>
+int StaticBPlusTree<ElemType>::Descend(const ElemType &key, CountFunc count) const
+// : Ը,ÿcountĸ,Ҷλ.ֵӦ
+//	ĺ,keyСֵʱ(UpperBound(ֵ))ֵ,ʱһ
+//	,лΪn
+{
+	int k = 0;									// ǰڱе
+	for (int h = height - 1; h > 0; h--)
+	{	// ڵhĽбȽ
+		k = k * STREE_FANOUT + count(keys + layerOffset[h] + k * STREE_NODE_KEYS, key);
+		if (k >= layerNodes[h - 1]) k = layerNodes[h - 1] - 1;	// 벻ڵĺ
+	}
+	int pos = k * STREE_NODE_KEYS + count(keys + k * STREE_NODE_KEYS, key);
+	return pos < n ? pos : n;
+}
+
+template <class ElemType>
+int StaticBPlusTree<ElemType>::LowerBound(const ElemType &key) const
+// : صһСkeyԪص,Сkeyʱn
+{
+	return Descend(key, [](const ElemType *node, const ElemType &k)
+		{ return STreeCountLess(node, k); });
+}
+
+template <class ElemType>
+int StaticBPlusTree<ElemType>::UpperBound(const ElemType &key) const
+// : صһkeyԪص,keyʱn
+{
+	return Descend(key, [](const ElemType *node, const ElemType &k)
+		{ return STreeCountNotGreater(node, k); });
+}
+
+template <class ElemType>
+int StaticBPlusTree<ElemType>::Search(const ElemType &key) const
+// : ҹؼֵֵkeyļ¼,ҳɹ,򷵻ش˼¼,򷵻-1
+{
+	int pos = LowerBound(key);
+	return pos < n && keys[pos] == key ? pos : -1;
+}
+
+template <class ElemType>
+void StaticBPlusTree<ElemType>::Range(const ElemType &low, const ElemType &high,
+	void (*visit)(const ElemType &)) const
+// : ζԲСlowҲhighԪصú(*visit),Ҷ,
+//	λ˳ɨ輴
+{
+	for (int i = LowerBound(low); i < n && !(high < keys[i]); i++)
+	{	// ڵԪ
+		(*visit)(keys[i]);
+	}
+}
+
+#endif
@@ -1,15 +1,17 @@
 #ifndef __INSERT_SORT_H__
 #define __INSERT_SORT_H__
 
-template <class ElemType>
-void StraightInsertSort(ElemType elem[], int n)
-// :elemֱӲ
+#include "sort_compare.h"		// ȽϺ
+
+template <class ElemType, class Compare = LessCompare>
+void StraightInsertSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemֱӲ
 {
 	for ( int i = 1; i < n; i++)
 	{	// iֱӲ
 		ElemType e = elem[i];			// ݴelem[i]
 		int j;							// ʱ
-		for (j = i - 1; j >= 0 && e < elem[j]; j--)
+		for (j = i - 1; j >= 0 && comp(e, elem[j]); j--)
 		{	// eļ¼
 			elem[j + 1] = elem[j];		// 
 		}
@@ -0,0 +1,170 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include "utility.h"						// ʵó
+#include <thread>							// ߳
+#include <mutex>							// 
+#include <condition_variable>				// 
+#include <functional>						// function
+#include <deque>							// 
+#include <vector>							// ߳
+#include <atomic>							// ԭӼ
+
+// ̳߳: ̶ĿĹ̴߳ӹȡִ
+class ThreadPool
+{
+protected:
+//  ̳߳صݳԱ:
+	vector<thread> workers;					// ߳
+	deque<function<void()> > tasks;			// ִе
+	mutex lock;								// 
+	condition_variable cond;				// ֹͣʱ֪ͨ߳
+	bool stop;								// Ƿֹͣ
+
+//	:
+	void WorkerLoop();						// ̵߳ѭ
+
+public:
+//  :
+	ThreadPool(int threadCount = 0);		// 캯, threadCountΪ0ʱȡӲ߳
+	~ThreadPool();							// ,ִύ߳
+	int ThreadCount() const;				// ع߳
+	void Submit(const function<void()> &task);	// ύ
+	bool RunPendingTask();					// ڵִ߳һִе
+
+private:
+	ThreadPool(const ThreadPool &copy);		// ֹ
+	ThreadPool &operator =(const ThreadPool &copy);	// ֵֹ
+};
+
+// : ¼һδɵĸ,ȴʱ߳Ҳִже,
+//	пͬһ̳߳ύ񲢵ȴ,̶߳ڵȴ
+class TaskGroup
+{
+protected:
+//  ݳԱ:
+	ThreadPool &pool;						// ̳߳
+	atomic<int> pending;					// δɵ
+
+public:
+//  :
+	TaskGroup(ThreadPool &p);				// 캯
+	~TaskGroup();							// ,ȴȫ
+	template <class Func>
+	void Run(Func task);					// ύڱ
+	void Wait();							// ȴȫ
+
+private:
+	TaskGroup(const TaskGroup &copy);		// ֹ
+	TaskGroup &operator =(const TaskGroup &copy);	// ֵֹ
+};
+
+// ̳߳ʵֲ
+inline ThreadPool::ThreadPool(int threadCount)
+// : threadCount߳, threadCountΪ0ʱȡӲ߳
+{
+	stop = false;
+	if (threadCount <= 0) threadCount = (int)thread::hardware_concurrency();
+	if (threadCount <= 0) threadCount = 1;
+	for (int i = 0; i < threadCount; i++)
+	{	// i߳
+		workers.push_back(thread(&ThreadPool::WorkerLoop, this));
+	}
+}
+
+inline ThreadPool::~ThreadPool()
+// : ִύ߳
+{
+	{	// ֹͣ־
+		unique_lock<mutex> guard(lock);
+		stop = true;
+	}
+	cond.notify_all();
+	for (int i = 0; i < (int)workers.size(); i++)
+	{	// ȴ߳̽
+		workers[i].join();
+	}
+}
+
+inline void ThreadPool::WorkerLoop()
+// : ȡִ,ֹͣҶΪʱ
+{
+	while (true)
+	{
+		function<void()> task;				// ȡ
+		{	// ȴ
+			unique_lock<mutex> guard(lock);
+			while (!stop && tasks.empty()) cond.wait(guard);
+			if (tasks.empty()) return;		// ֹͣ
+			task = tasks.front();
+			tasks.pop_front();
+		}
+		task();
+	}
+}
+
+inline int ThreadPool::ThreadCount() const
+// : ع߳
+{
+	return (int)workers.size();
+}
+
+inline void ThreadPool::Submit(const function<void()> &task)
+// : taskвһ߳
+{
+	{	// 
+		unique_lock<mutex> guard(lock);
+		tasks.push_back(task);
+	}
+	cond.notify_one();
+}
+
+inline bool ThreadPool::RunPendingTask()
+// : зǿʱڵִ߳ύ񲢷true,򷵻false.
+//	ȡύʹݹֽڱ߳,ڻ
+{
+	function<void()> task;					// ȡ
+	{	// 
+		unique_lock<mutex> guard(lock);
+		if (tasks.empty()) return false;
+		task = tasks.back();
+		tasks.pop_back();
+	}
+	task();
+	return true;
+}
+
+// ʵֲ
+inline TaskGroup::TaskGroup(ThreadPool &p): pool(p), pending(0)
+// : ̳߳pĿ
+{
+}
+
+inline TaskGroup::~TaskGroup()
+// : ȴȫ
+{
+	Wait();
+}
+
+template <class Func>
+void TaskGroup::Run(Func task)
+// : ̳߳ύtask,ʱٱδɵ
+{
+	pending++;
+	pool.Submit([this, task]()
+	{	// ִ񲢼
+		task();
+		pending--;
+	});
+}
+
+inline void TaskGroup::Wait()
+// : ڱδȫʱִже,Ϊó
+{
+	while (pending > 0)
+	{	// δɵ
+		if (!pool.RunPendingTask()) this_thread::yield();
+	}
+}
+
+#endif
@@ -0,0 +1,346 @@
+#ifndef __TIM_SORT_H__
+#define __TIM_SORT_H__
+
+#include "utility.h"				// ʵó
+#include "exponential_serach.h"		// 
+
+#define TIM_SORT_MIN_MERGE 32		// ڴ˳ȵֱ۰
+#define TIM_SORT_MIN_GALLOP 7		// һʤ˴뱶ģʽ
+#define TIM_SORT_MAX_RUNS 64		// γջ,γ̳Ȱ쳲,㹻intΧ
+
+// Ӧ鲢(TimSort): ɨγ(ϸݼγ̾͵طת),γ۰
+//	㵽С,γջջгԼϲ.鲢ʱֻ϶̵γʱ,
+//	ֱӹ鲢ԭλ,帴ƻ;һʤʱΪҳɶƶ.ȶ,
+//	ʱӽO(n)
+
+inline int TimSortMinRun(int n)
+// :Сγ̳,ʹn / minRunӽҲ2
+{
+	int r = 0;						// ƳλǷ1
+	while (n >= TIM_SORT_MIN_MERGE)
+	{	// 5λ
+		r |= n & 1;
+		n >>= 1;
+	}
+	return n + r;
+}
+
+template <class ElemType, class Compare = LessCompare>
+int TimSortCountRun(ElemType elem[], int low, int high, Compare comp = Compare())
+// :شelem[low]ʼγ̳,γ̲elem[high - 1],ϸݼγ
+//	תΪ
+{
+	int runHigh = low + 1;
+	if (runHigh == high) return 1;
+	if (comp(elem[runHigh++], elem[low]))
+	{	// ϸݼ,תȶ
+		while (runHigh < high && comp(elem[runHigh], elem[runHigh - 1])) runHigh++;
+		for (int i = low, j = runHigh - 1; i < j; i++, j--)
+		{	// ת
+			Swap(elem[i], elem[j]);
+		}
+	}
+	else
+	{	// ǵݼ
+		while (runHigh < high && !comp(elem[runHigh], elem[runHigh - 1])) runHigh++;
+	}
+	return runHigh - low;
+}
+
+template <class ElemType, class Compare = LessCompare>
+void TimSortBinaryInsert(ElemType elem[], int low, int high, int start,
+	Compare comp = Compare())
+// ʼ:elem[low .. start - 1]
+// :۰ʹelem[low .. high - 1]
+{
+	for (int i = start; i < high; i++)
+	{	// elem[i]
+		ElemType e = elem[i];
+		int left = low, right = i;	// λ[left, right],Ԫ֮
+		while (left < right)
+		{	// ۰Ҳλ
+			int mid = left + (right - left) / 2;
+			if (comp(e, elem[mid])) right = mid;
+			else left = mid + 1;
+		}
+		for (int j = i; j > left; j--)
+		{	// 
+			elem[j] = elem[j - 1];
+		}
+		elem[left] = e;
+	}
+}
+
+template <class ElemType, class Compare = LessCompare>
+void TimSortMergeLow(ElemType elem[], int base1, int len1, int base2, int len2,
+	ElemType tmpElem[], int &minGallop, Compare comp = Compare())
+// ʼ:len1 <= len2, elem[base1 .. base1 + len1 - 1]elem[base2 .. base2 + len2 - 1]
+//	,ǰԪشںԪ,ǰĩԪشںĩԪ
+// :ǰһγtmpElem,ҹ鲢elem[base1 ..]
+{
+	int i, cur1 = 0, cur2 = base2, dest = base1;
+	for (i = 0; i < len1; i++) tmpElem[i] = elem[base1 + i];
+
+	elem[dest++] = elem[cur2++];	// һγԪС
+	if (--len2 == 0)
+	{	// һγ
+		for (i = 0; i < len1; i++) elem[dest + i] = tmpElem[cur1 + i];
+		return;
+	}
+	if (len1 == 1)
+	{	// ǰһγֻʣĩԪ,
+		for (i = 0; i < len2; i++) elem[dest + i] = elem[cur2 + i];
+		elem[dest + len2] = tmpElem[cur1];
+		return;
+	}
+
+	bool done = false;				// Ƿһ(ǰһʣ1Ҳ)
+	while (!done)
+	{
+		int count1 = 0, count2 = 0;	// ʤĴ
+		do
+		{	// Ƚ
+			if (comp(elem[cur2], tmpElem[cur1]))
+			{	// һγ̵ԪؽС
+				elem[dest++] = elem[cur2++];
+				count2++;
+				count1 = 0;
+				if (--len2 == 0) done = true;
+			}
+			else
+			{	// ǰһγ̵ԪؽС,ȹ鲢Աȶ
+				elem[dest++] = tmpElem[cur1++];
+				count1++;
+				count2 = 0;
+				if (--len1 == 1) done = true;
+			}
+		} while (!done && (count1 | count2) < minGallop);
+
+		while (!done)
+		{	// ģʽ:ñһƶԪظ
+			count1 = GallopUpperBound(tmpElem + cur1, len1, elem[cur2], 0, comp);
+			if (count1 != 0)
+			{	// ǰһγвelem[cur2]Ԫسɶƶ
+				for (i = 0; i < count1; i++) elem[dest + i] = tmpElem[cur1 + i];
+				dest += count1;
+				cur1 += count1;
+				len1 -= count1;
+				if (len1 <= 1) { done = true; break; }
+			}
+			elem[dest++] = elem[cur2++];
+			if (--len2 == 0) { done = true; break; }
+
+			count2 = GallopLowerBound(elem + cur2, len2, tmpElem[cur1], 0, comp);
+			if (count2 != 0)
+			{	// һγСtmpElem[cur1]Ԫسɶƶ
+				for (i = 0; i < count2; i++) elem[dest + i] = elem[cur2 + i];
+				dest += count2;
+				cur2 += count2;
+				len2 -= count2;
+				if (len2 == 0) { done = true; break; }
+			}
+			elem[dest++] = tmpElem[cur1++];
+			if (--len1 == 1) { done = true; break; }
+
+			if (minGallop > 0) minGallop--;	// Ч,ͽż
+			if (count1 < TIM_SORT_MIN_GALLOP && count2 < TIM_SORT_MIN_GALLOP)
+			{	// Ч,صȽ
+				minGallop += 2;
+				break;
+			}
+		}
+	}
+	if (minGallop < 1) minGallop = 1;
+
+	if (len1 == 1)
+	{	// ǰһγֻʣ1Ԫ,ںһγʣԪ
+		for (i = 0; i < len2; i++) elem[dest + i] = elem[cur2 + i];
+		elem[dest + len2] = tmpElem[cur1];
+	}
+	else
+	{	// һγ
+		for (i = 0; i < len1; i++) elem[dest + i] = tmpElem[cur1 + i];
+	}
+}
+
+template <class ElemType, class Compare = LessCompare>
+void TimSortMergeHigh(ElemType elem[], int base1, int len1, int base2, int len2,
+	ElemType tmpElem[], int &minGallop, Compare comp = Compare())
+// ʼ:len1 > len2,γ,ǰԪشںԪ,ǰĩԪشں
+//	ĩԪ
+// :һγtmpElem,鲢elem[.. base2 + len2 - 1]
+{
+	int i, cur1 = base1 + len1 - 1, cur2 = len2 - 1, dest = base2 + len2 - 1;
+	for (i = 0; i < len2; i++) tmpElem[i] = elem[base2 + i];
+
+	elem[dest--] = elem[cur1--];	// ǰһγĩԪ
+	if (--len1 == 0)
+	{	// ǰһγ
+		for (i = 0; i < len2; i++) elem[dest - len2 + 1 + i] = tmpElem[i];
+		return;
+	}
+	if (len2 == 1)
+	{	// һγֻʣԪ,С
+		dest -= len1;
+		cur1 -= len1;
+		for (i = len1; i > 0; i--) elem[dest + i] = elem[cur1 + i];
+		elem[dest] = tmpElem[cur2];
+		return;
+	}
+
+	bool done = false;				// Ƿһ(һʣ1Ҳ)
+	while (!done)
+	{
+		int count1 = 0, count2 = 0;	// ʤĴ
+		do
+		{	// Ƚ,ϴ߷ŵҶ
+			if (comp(tmpElem[cur2], elem[cur1]))
+			{	// ǰһγ̵Ԫؽϴ
+				elem[dest--] = elem[cur1--];
+				count1++;
+				count2 = 0;
+				if (--len1 == 0) done = true;
+			}
+			else
+			{	// һγ̵Ԫؽϴ,ȷŵҶԱȶ
+				elem[dest--] = tmpElem[cur2--];
+				count2++;
+				count1 = 0;
+				if (--len2 == 1) done = true;
+			}
+		} while (!done && (count1 | count2) < minGallop);
+
+		while (!done)
+		{	// ģʽ,Ҷ˿ʼ
+			count1 = len1 - GallopUpperBound(elem + base1, len1, tmpElem[cur2], len1 - 1, comp);
+			if (count1 != 0)
+			{	// ǰһγдtmpElem[cur2]Ԫسɶ
+				dest -= count1;
+				cur1 -= count1;
+				len1 -= count1;
+				for (i = count1; i > 0; i--) elem[dest + i] = elem[cur1 + i];
+				if (len1 == 0) { done = true; break; }
+			}
+			elem[dest--] = tmpElem[cur2--];
+			if (--len2 == 1) { done = true; break; }
+
+			count2 = len2 - GallopLowerBound(tmpElem, len2, elem[cur1], len2 - 1, comp);
+			if (count2 != 0)
+			{	// һγвСelem[cur1]Ԫسɶƶ
+				dest -= count2;
+				cur2 -= count2;
+				len2 -= count2;
+				for (i = count2; i > 0; i--) elem[dest + i] = tmpElem[cur2 + i];
+				if (len2 <= 1) { done = true; break; }
+			}
+			elem[dest--] = elem[cur1--];
+			if (--len1 == 0) { done = true; break; }
+
+			if (minGallop > 0) minGallop--;	// Ч,ͽż
+			if (count1 < TIM_SORT_MIN_GALLOP && count2 < TIM_SORT_MIN_GALLOP)
+			{	// Ч,صȽ
+				minGallop += 2;
+				break;
+			}
+		}
+	}
+	if (minGallop < 1) minGallop = 1;
+
+	if (len2 == 1)
+	{	// һγֻʣ1Ԫ,СǰһγʣԪ
+		dest -= len1;
+		cur1 -= len1;
+		for (i = len1; i > 0; i--) elem[dest + i] = elem[cur1 + i];
+		elem[dest] = tmpElem[cur2];
+	}
+	else
+	{	// ǰһγ
+		for (i = 0; i < len2; i++) elem[dest - len2 + 1 + i] = tmpElem[i];
+	}
+}
+
+template <class ElemType, class Compare = LessCompare>
+void TimSortMergeAt(ElemType elem[], int runBase[], int runLen[], int &stackSize, int k,
+	ElemType tmpElem[], int &minGallop, Compare comp = Compare())
+// :ϲγջеkk + 1γ
+{
+	int base1 = runBase[k], len1 = runLen[k];
+	int base2 = runBase[k + 1], len2 = runLen[k + 1];
+	runLen[k] = len1 + len2;
+	if (k == stackSize - 3)
+	{	// ϲǴջ,ջ
+		runBase[k + 1] = runBase[k + 2];
+		runLen[k + 1] = runLen[k + 2];
+	}
+	stackSize--;
+
+	int skip = GallopUpperBound(elem + base1, len1, elem[base2], 0, comp);
+		// ǰһγвںһγԪصԪλ
+	base1 += skip;
+	len1 -= skip;
+	if (len1 == 0) return;
+	len2 = GallopLowerBound(elem + base2, len2, elem[base1 + len1 - 1], len2 - 1, comp);
+		// һγвСǰһγĩԪصԪλ
+	if (len2 == 0) return;
+
+	if (len1 <= len2) TimSortMergeLow(elem, base1, len1, base2, len2, tmpElem, minGallop, comp);
+	else TimSortMergeHigh(elem, base1, len1, base2, len2, tmpElem, minGallop, comp);
+}
+
+template <class ElemType, class Compare = LessCompare>
+void TimSort(ElemType elem[], int n, Compare comp = Compare())
+// :ȽϺcompelemӦȶ鲢
+{
+	if (n < 2) return;
+	if (n < TIM_SORT_MIN_MERGE)
+	{	// ۰
+		TimSortBinaryInsert(elem, 0, n, TimSortCountRun(elem, 0, n, comp), comp);
+		return;
+	}
+
+	ElemType *tmpElem = new ElemType[n / 2 + 1];	// ֻɽ϶̵γ
+	int runBase[TIM_SORT_MAX_RUNS], runLen[TIM_SORT_MAX_RUNS], stackSize = 0;	// γջ
+	int minGallop = TIM_SORT_MIN_GALLOP;			// 뱶ģʽż,Ч
+	int minRun = TimSortMinRun(n);
+
+	for (int low = 0; low < n; )
+	{	// ɨһγ
+		int len = TimSortCountRun(elem, low, n, comp);
+		if (len < minRun)
+		{	// 㵽Сγ̳
+			int force = n - low < minRun ? n - low : minRun;
+			TimSortBinaryInsert(elem, low, low + force, low + len, comp);
+			len = force;
+		}
+		runBase[stackSize] = low;
+		runLen[stackSize] = len;
+		stackSize++;
+
+		while (stackSize > 1)
+		{	// ջγ̳runLen[k - 2] > runLen[k - 1] + runLen[k],
+			//	runLen[k - 1] > runLen[k],ʹϲջΪO(logn)
+			int k = stackSize - 2;
+			if ((k > 0 && runLen[k - 1] <= runLen[k] + runLen[k + 1]) ||
+				(k > 1 && runLen[k - 2] <= runLen[k - 1] + runLen[k]))
+			{	// ϶̵γ̺ϲ
+				if (runLen[k - 1] < runLen[k + 1]) k--;
+			}
+			else if (runLen[k] > runLen[k + 1])
+			{	// Լ
+				break;
+			}
+			TimSortMergeAt(elem, runBase, runLen, stackSize, k, tmpElem, minGallop, comp);
+		}
+		low += len;
+	}
+
+	while (stackSize > 1)
+	{	// ϲʣγ
+		int k = stackSize - 2;
+		if (k > 0 && runLen[k - 1] < runLen[k + 1]) k--;
+		TimSortMergeAt(elem, runBase, runLen, stackSize, k, tmpElem, minGallop, comp);
+	}
+	delete []tmpElem;				// ͷtmpElemռÿռ
+}
+
+#endif
@@ -75,6 +75,7 @@ static void SetRandSeed();		// 
 static int GetRand(int n);		// 0 ~ n-1֮
 static int GetRand();			// 
 static int GetPoissionRand(double expectValue);// ֵΪexpectValue 
+static unsigned long long HashMix(unsigned long long key);	// ؼֻΪ64λɢֵ
 template <class ElemType >
 void Swap(ElemType &e1, ElemType &e2);	// e1, e2ֵ֮
 template<class ElemType>
@@ -203,6 +204,17 @@ static int GetPoissionRand(double expectValue)
 	return k - 1;							// k-1ֵϣֵΪexpectValueĲɷֲ
 }
 
+static unsigned long long HashMix(unsigned long long key)
+// : ؼֻΪ64λɢֵ,ʹؼֵÿһλӰɢֵÿһλ
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+	return key;
+}
+
 template <class ElemType >
 void Swap(ElemType &e1, ElemType &e2)
 // : e1, e2ֵ֮